@@ -10,10 +10,13 @@
 
 #include "1_Radio.h"
 #include "2_Signal.h"
+#include "5_Plugin.h"
 #include "6_MQTT.h"
 #include "9_Serial2Net.h"
 #include "10_Wifi.h"
 #include "12_Portal.h"
+#include "17_NoiseFloor.h"
+#include "18_CaptureStream.h"
 
 #if defined(DEBUG) || defined(RFLINK_DEBUG)
 #define DEBUG_RFLINK_CONFIG
@@ -42,6 +45,7 @@ namespace RFLink
             "signal",
             "radio",
             "serial2net",
+            "plugins",
             "root" // this is always the last one and matches index SectionId::EOF_id
     };
 
@@ -56,12 +60,17 @@ namespace RFLink
             &RFLink::Mqtt::configItems[0],
             #endif // RFLINK_MQTT_DISABLED
             &RFLink::Serial2Net::configItems[0],
+            #ifndef RFLINK_CAPTURE_STREAM_DISABLED
+            &RFLink::CaptureStream::configItems[0],
+            #endif // RFLINK_CAPTURE_STREAM_DISABLED
             #ifndef RFLINK_PORTAL_DISABLED
             &RFLink::Portal::configItems[0],
             #endif // RFLINK_PORTAL_DISABLED
 #endif
             &RFLink::Signal::configItems[0],
             &RFLink::Radio::configItems[0],
+            &RFLink::NoiseFloor::configItems[0],
+            &RFLink::Plugins::configItems[0],
     };
 #define configItemListsSize (sizeof(configItemLists) / sizeof(ConfigItem *))
 
@@ -501,7 +510,12 @@ namespace RFLink
           Serial.println(F("Config file saved to flash."));
         }
         if (triggerUpdateCallbacks)
+        {
+          // the callbacks rebuild the plugin order and restart the scanner, the decode task must not run meanwhile
+          Signal::AsyncSignalScanner::lockDecoder();
           callbackMgr.execute();
+          Signal::AsyncSignalScanner::unlockDecoder();
+        }
       }
       else
       {
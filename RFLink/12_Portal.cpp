@@ -8,6 +8,10 @@
 #include <LittleFS.h>
 
 #include "2_Signal.h"
+#include "5_Plugin.h"
+#include "15_DedupCache.h"
+#include "17_NoiseFloor.h"
+#include "18_CaptureStream.h"
 #include "6_MQTT.h"
 #include "9_Serial2Net.h"
 #include "11_Config.h"
@@ -28,6 +32,15 @@
 
 namespace RFLink { namespace Portal {
 
+    // /api/status, mostly taken by the plugins order and stats
+    #ifndef RFLINK_STATUS_JSON_BUFFER_SIZE
+      #ifdef ESP8266
+        #define RFLINK_STATUS_JSON_BUFFER_SIZE 4096
+      #else
+        #define RFLINK_STATUS_JSON_BUFFER_SIZE 6144
+      #endif
+    #endif
+
         const char json_name_enabled[] = "enabled";
         const char json_name_auth_enabled[] = "auth_enabled";
         const char json_name_auth_user[] = "auth_user";
@@ -84,7 +97,7 @@ namespace RFLink { namespace Portal {
           if(!checkHttpAuthentication(request))
             return;
 
-          DynamicJsonDocument output(1000);
+          DynamicJsonDocument output(RFLINK_STATUS_JSON_BUFFER_SIZE);
 
           auto && obj = output.to<JsonObject>();
 
@@ -95,10 +108,16 @@ namespace RFLink { namespace Portal {
           RFLink::Mqtt::getStatusJsonString(obj);
           #endif // RFLINK_MQTT_DISABLED
           RFLink::Signal::getStatusJsonString(obj);
+          RFLink::Plugins::getStatusJsonString(obj);
+          RFLink::DedupCache::getStatusJsonString(obj);
+          RFLink::NoiseFloor::getStatusJsonString(obj);
           RFLink::Serial2Net::getStatusJsonString(obj);
+          #ifndef RFLINK_CAPTURE_STREAM_DISABLED
+          RFLink::CaptureStream::getStatusJsonString(obj);
+          #endif // RFLINK_CAPTURE_STREAM_DISABLED
 
           String buffer;
-          if(!buffer.reserve(512) ) {
+          if(!buffer.reserve(1024) ) {
             request->send(500, F("text/plain"), F("Not enough memory"));
             return;
           }
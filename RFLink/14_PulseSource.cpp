@@ -0,0 +1,101 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include "14_PulseSource.h"
+
+namespace RFLink
+{
+  namespace Signal
+  {
+    GpioPulseSource gpioPulseSource;
+
+    ReplayPulseSource::ReplayPulseSource(FILE *trace, unsigned int pollCost_us, unsigned int rssiCost_us)
+    {
+      this->trace = trace;
+      this->pollCost_us = pollCost_us;
+      this->rssiCost_us = rssiCost_us;
+      level = LOW;
+      rssi = -120.0F;
+      nextRssi = rssi;
+      lastEdge_us = 0;
+      edgesCount = 0;
+      rssiReads = 0;
+
+      hasNextEdge = fetchNextEdge();
+      now_us = hasNextEdge ? nextEdge_us : 0; // no need to spin through whatever happened before the first edge
+    }
+
+    bool ReplayPulseSource::fetchNextEdge()
+    {
+      char line[64];
+
+      while (trace != nullptr && fgets(line, sizeof(line), trace) != nullptr)
+      {
+        unsigned long long timestamp;
+        int newLevel;
+        float newRssi;
+
+        if (line[0] == '#')
+          continue;
+
+        int fields = sscanf(line, "%llu %d %f", &timestamp, &newLevel, &newRssi);
+        if (fields < 2)
+          continue;
+
+        nextEdge_us = timestamp;
+        nextLevel = newLevel ? HIGH : LOW;
+        if (fields == 3)
+          nextRssi = newRssi;
+        return true;
+      }
+
+      return false;
+    }
+
+    void ReplayPulseSource::advance(unsigned int us)
+    {
+      now_us += us;
+
+      while (hasNextEdge && nextEdge_us <= now_us)
+      {
+        level = nextLevel;
+        rssi = nextRssi;
+        lastEdge_us = nextEdge_us;
+        edgesCount++;
+        hasNextEdge = fetchNextEdge();
+      }
+    }
+
+    int ReplayPulseSource::readLevel()
+    {
+      advance(pollCost_us);
+      return level;
+    }
+
+    unsigned long ReplayPulseSource::micros()
+    {
+      return (unsigned long)now_us;
+    }
+
+    unsigned long ReplayPulseSource::millis()
+    {
+      return (unsigned long)(now_us / 1000);
+    }
+
+    float ReplayPulseSource::readRssi()
+    {
+      rssiReads++;
+      advance(rssiCost_us);
+      return rssi;
+    }
+
+    bool ReplayPulseSource::exhausted()
+    {
+      return !hasNextEdge && now_us > lastEdge_us + idleTail_us;
+    }
+
+  } // end of ns Signal
+} // end of ns RFLink
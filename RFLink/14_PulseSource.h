@@ -0,0 +1,142 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _14_PulseSource_H_
+#define _14_PulseSource_H_
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "1_Radio.h"
+
+namespace RFLink
+{
+  namespace Signal
+  {
+    /**
+     * Where the synchronous slicers read the receiver output level, the time and the RSSI from.
+     * */
+    class PulseSource
+    {
+    public:
+      virtual ~PulseSource() {}
+
+      /// Current level (HIGH/LOW) of the receiver data output
+      virtual int readLevel() = 0;
+      virtual unsigned long micros() = 0;
+      virtual unsigned long millis() = 0;
+      /// Current RSSI in dBm
+      virtual float readRssi() = 0;
+      /// true when no more edges will ever come from this source
+      virtual bool exhausted() { return false; }
+    };
+
+    /**
+     * The real thing: RX_DATA pin of the transceiver and its RSSI register.
+     * */
+    class GpioPulseSource : public PulseSource
+    {
+    public:
+      int readLevel() override { return digitalRead(Radio::pins::RX_DATA); }
+      unsigned long micros() override { return ::micros(); }
+      unsigned long millis() override { return ::millis(); }
+      float readRssi() override { return Radio::getCurrentRssi(); }
+    };
+
+    /**
+     * Replays a recorded edge trace against a virtual clock, so slicers run much faster than real time.
+     *
+     * The trace is a text stream with one edge per line: "<timestamp_us> <level> [rssi_dBm]".
+     * Timestamps must be increasing, the RSSI is kept until the next line giving one.
+     * Empty lines and lines starting with '#' are ignored.
+     *
+     * Every readLevel() advances the virtual clock by pollCost_us, every readRssi() by rssiCost_us,
+     * which models the time the same calls take on the device.
+     * */
+    class ReplayPulseSource : public PulseSource
+    {
+    public:
+      ReplayPulseSource(FILE *trace, unsigned int pollCost_us = 1, unsigned int rssiCost_us = 30);
+
+      int readLevel() override;
+      unsigned long micros() override;
+      unsigned long millis() override;
+      float readRssi() override;
+      bool exhausted() override;
+
+      inline unsigned long long getEdgesCount() { return edgesCount; }
+      inline unsigned long long getVirtualTime_us() { return now_us; }
+      inline unsigned long long getRssiReadsCount() { return rssiReads; }
+
+    private:
+      static const unsigned long idleTail_us = 100000; // keeps the source alive long enough for slicers to close the last frame
+
+      FILE *trace;
+      unsigned int pollCost_us;
+      unsigned int rssiCost_us;
+
+      unsigned long long now_us;
+      int level;
+      float rssi;
+
+      bool hasNextEdge;
+      unsigned long long nextEdge_us;
+      int nextLevel;
+      float nextRssi;
+      unsigned long long lastEdge_us;
+      unsigned long long edgesCount;
+      unsigned long long rssiReads;
+
+      void advance(unsigned int us);
+      bool fetchNextEdge();
+    };
+
+    /**
+     * Reads the RSSI of a source at most once every interval_us and hands out the cached value in between,
+     * so a slicer can keep polling the data output at full speed instead of waiting for an SPI transaction on every poll.
+     * An interval of 0 reads the RSSI every time.
+     * */
+    class RssiSampler
+    {
+    public:
+      RssiSampler(PulseSource *source, unsigned long interval_us)
+          : source(source), interval_us(interval_us), lastRead_us(source->micros() - interval_us), lastRssi(-9999.0F), reads(0) {}
+
+      /// Reads the RSSI now
+      inline float read()
+      {
+        lastRead_us = source->micros();
+        lastRssi = source->readRssi();
+        reads++;
+        return lastRssi;
+      }
+
+      /// Reads the RSSI if interval_us has elapsed since the last read, returns the last value otherwise
+      inline float sample()
+      {
+        if (source->micros() - lastRead_us >= interval_us)
+          return read();
+        return lastRssi;
+      }
+
+      /// When the last value was read, which is when the RSSI was that much
+      inline unsigned long getLastRead_us() { return lastRead_us; }
+      inline float getLastRssi() { return lastRssi; }
+      inline unsigned long getReadsCount() { return reads; }
+
+    private:
+      PulseSource *source;
+      unsigned long interval_us;
+      unsigned long lastRead_us;
+      float lastRssi;
+      unsigned long reads;
+    };
+
+    extern GpioPulseSource gpioPulseSource;
+
+  } // end of ns Signal
+} // end of ns RFLink
+
+#endif // _14_PulseSource_H_
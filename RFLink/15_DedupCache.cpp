@@ -0,0 +1,140 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include "15_DedupCache.h"
+
+static_assert((DEDUP_CACHE_SLOTS & (DEDUP_CACHE_SLOTS - 1)) == 0, "DEDUP_CACHE_SLOTS must be a power of 2");
+static_assert(DEDUP_CACHE_MAX_PROBES <= DEDUP_CACHE_SLOTS, "DEDUP_CACHE_MAX_PROBES must not exceed DEDUP_CACHE_SLOTS");
+
+namespace RFLink
+{
+  namespace DedupCache
+  {
+    namespace counters
+    {
+      unsigned long int hits = 0;
+      unsigned long int misses = 0;
+      unsigned long int evictions = 0;
+    }
+
+    namespace runtime
+    {
+      PayloadRecord lastRecord = {0, 0, 0};
+    }
+
+    struct Entry
+    {
+      unsigned long payload;
+      unsigned long seen_ms;
+      unsigned long ttl_ms;
+      byte pluginNumber; // 0: free slot
+    };
+
+    Entry entries[DEDUP_CACHE_SLOTS];
+
+    static inline unsigned long mix(byte pluginNumber, unsigned long payload)
+    {
+      // murmur3 finalizer, spreads close payloads (sequence numbers, ids) over the table
+      uint32_t h = payload ^ ((uint32_t)pluginNumber * 0x9E3779B9UL);
+      h ^= h >> 16;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16;
+      return h;
+    }
+
+    static inline bool isExpired(const Entry &entry, unsigned long now_ms)
+    {
+      return entry.pluginNumber == 0 || (now_ms - entry.seen_ms) > entry.ttl_ms;
+    }
+
+    bool isNewPayload(byte pluginNumber, unsigned long payload, unsigned long ttl_ms)
+    {
+      const unsigned long now_ms = millis();
+      const unsigned long start = mix(pluginNumber, payload);
+      Entry *freeEntry = nullptr;
+      Entry *oldestEntry = nullptr;
+
+      runtime::lastRecord.pluginNumber = pluginNumber;
+      runtime::lastRecord.payload = payload;
+      runtime::lastRecord.ttl_ms = ttl_ms;
+
+      // no tombstones: the whole window is always scanned, a payload can live in any of its slots
+      for (byte probe = 0; probe < DEDUP_CACHE_MAX_PROBES; probe++)
+      {
+        Entry &entry = entries[(start + probe) & (DEDUP_CACHE_SLOTS - 1)];
+
+        if (isExpired(entry, now_ms))
+        {
+          if (freeEntry == nullptr)
+            freeEntry = &entry;
+          continue;
+        }
+
+        if (entry.pluginNumber == pluginNumber && entry.payload == payload)
+        {
+          entry.seen_ms = now_ms;
+          entry.ttl_ms = ttl_ms;
+          counters::hits++;
+          return false;
+        }
+
+        if (oldestEntry == nullptr || (now_ms - entry.seen_ms) > (now_ms - oldestEntry->seen_ms))
+          oldestEntry = &entry;
+      }
+
+      if (freeEntry == nullptr)
+      {
+        freeEntry = oldestEntry;
+        counters::evictions++;
+      }
+
+      freeEntry->payload = payload;
+      freeEntry->seen_ms = now_ms;
+      freeEntry->ttl_ms = ttl_ms;
+      freeEntry->pluginNumber = pluginNumber;
+      counters::misses++;
+      return true;
+    }
+
+    bool isNewPayload(byte pluginNumber, const void *payload, size_t length, unsigned long ttl_ms)
+    {
+      // FNV-1a
+      const byte *bytes = (const byte *)payload;
+      uint32_t hash = 2166136261UL;
+
+      for (size_t i = 0; i < length; i++)
+      {
+        hash ^= bytes[i];
+        hash *= 16777619UL;
+      }
+      return isNewPayload(pluginNumber, (unsigned long)hash, ttl_ms);
+    }
+
+    void reset()
+    {
+      memset(entries, 0, sizeof(entries));
+      runtime::lastRecord.pluginNumber = 0;
+    }
+
+    void resetCounters()
+    {
+      counters::hits = 0;
+      counters::misses = 0;
+      counters::evictions = 0;
+    }
+
+    void getStatusJsonString(JsonObject &output)
+    {
+      auto &&dedup = output.createNestedObject("dedup_cache");
+      dedup[F("slots")] = DEDUP_CACHE_SLOTS;
+      dedup[F("hits")] = counters::hits;
+      dedup[F("misses")] = counters::misses;
+      dedup[F("evictions")] = counters::evictions;
+    }
+  }
+}
@@ -0,0 +1,72 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _15_DedupCache_H_
+#define _15_DedupCache_H_
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#ifndef DEDUP_CACHE_SLOTS
+#define DEDUP_CACHE_SLOTS 32      // must be a power of 2
+#endif
+#define DEDUP_CACHE_MAX_PROBES 8  // slots looked at for one payload, bounds the time of a lookup
+
+namespace RFLink
+{
+  /**
+   * Remembers the payloads recently decoded by the plugins to drop the repeats of a burst, per device:
+   * unlike the single SignalCRC, two sensors whose bursts interleave do not reset each other's filter.
+   * Open addressing table with a bounded probe window, constant memory and time.
+   * */
+  namespace DedupCache
+  {
+    namespace counters
+    {
+      extern unsigned long int hits;      // repeats which have been dropped
+      extern unsigned long int misses;    // new payloads
+      extern unsigned long int evictions; // live entries replaced because their probe window was full
+    }
+
+    struct PayloadRecord
+    {
+      byte pluginNumber; // 0: none
+      unsigned long payload;
+      unsigned long ttl_ms;
+    };
+
+    namespace runtime
+    {
+      extern PayloadRecord lastRecord; // arguments of the last isNewPayload() call
+    }
+
+    /**
+     * Tells if a payload has not been seen in the last ttl_ms for this plugin, and records it.
+     * A repeat refreshes the entry, so a burst is dropped until it stops for ttl_ms.
+     * @param pluginNumber number of the calling plugin (the xxx of Plugin_xxx)
+     * @param payload decoded bits (or their hash) identifying the device and its data
+     * @return true if the payload is new and must be reported
+     * */
+    bool isNewPayload(byte pluginNumber, unsigned long payload, unsigned long ttl_ms);
+    /// Same as above, for payloads longer than 32 bits
+    bool isNewPayload(byte pluginNumber, const void *payload, size_t length, unsigned long ttl_ms);
+    /**
+     * Refreshes a payload recorded earlier (see runtime::lastRecord) as if its plugin had decoded it again.
+     * Used when a repeat is dropped before reaching the plugins, so the burst stays filtered.
+     * */
+    inline void refresh(const PayloadRecord &record)
+    {
+      if (record.pluginNumber != 0)
+        isNewPayload(record.pluginNumber, record.payload, record.ttl_ms);
+    }
+
+    void reset();
+    void resetCounters();
+    void getStatusJsonString(JsonObject &output);
+  }
+}
+
+#endif // _15_DedupCache_H_
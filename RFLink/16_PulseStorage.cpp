@@ -0,0 +1,60 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include "16_PulseStorage.h"
+
+#ifndef DRAM_ATTR
+#define DRAM_ATTR
+#endif
+
+namespace RFLink
+{
+  namespace Signal
+  {
+    namespace PulseCodec
+    {
+      // 0..63 then round(64 * (65535 / 64) ^ ((code - 64) / 191))
+      DRAM_ATTR const uint16_t decodeTable[256] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+        32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+        48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+        64, 66, 69, 71, 74, 77, 80, 83, 86, 89, 92, 95, 99, 103, 106, 110,
+        114, 119, 123, 128, 132, 137, 142, 147, 153, 159, 164, 170, 177, 183, 190, 197,
+        204, 212, 220, 228, 236, 245, 254, 264, 273, 283, 294, 305, 316, 328, 340, 352,
+        365, 379, 393, 407, 422, 438, 454, 471, 488, 506, 525, 545, 565, 586, 607, 630,
+        653, 677, 702, 728, 755, 783, 812, 842, 873, 905, 939, 973, 1009, 1047, 1085, 1125,
+        1167, 1210, 1255, 1301, 1349, 1399, 1451, 1504, 1560, 1618, 1677, 1739, 1804, 1870, 1939, 2011,
+        2085, 2163, 2242, 2325, 2411, 2500, 2593, 2689, 2788, 2891, 2998, 3109, 3224, 3343, 3466, 3594,
+        3727, 3865, 4008, 4156, 4309, 4469, 4634, 4805, 4983, 5167, 5358, 5556, 5761, 5974, 6195, 6424,
+        6661, 6907, 7163, 7427, 7702, 7986, 8282, 8588, 8905, 9234, 9575, 9929, 10296, 10677, 11071, 11480,
+        11905, 12345, 12801, 13274, 13765, 14273, 14801, 15348, 15915, 16503, 17113, 17745, 18401, 19081, 19787, 20518,
+        21276, 22062, 22878, 23723, 24600, 25509, 26452, 27429, 28443, 29494, 30584, 31715, 32887, 34102, 35362, 36669,
+        38024, 39430, 40887, 42398, 43965, 45590, 47275, 49022, 50833, 52712, 54660, 56680, 58775, 60947, 63199, 65535      };
+
+      uint8_t IRAM_ATTR encode(uint16_t length)
+      {
+        if (length < 64)
+          return length;
+
+        // highest code whose length is not above the given one
+        uint8_t low = 63, high = 255;
+        while (low < high)
+        {
+          uint8_t middle = low + (high - low + 1) / 2;
+          if (decodeTable[middle] <= length)
+            low = middle;
+          else
+            high = middle - 1;
+        }
+
+        if (low < 255 && (decodeTable[low + 1] - length) < (length - decodeTable[low]))
+          return low + 1;
+        return low;
+      }
+    }
+  }
+}
@@ -0,0 +1,207 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _16_PulseStorage_H_
+#define _16_PulseStorage_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <math.h>
+#include "RFLink.h"
+
+namespace RFLink
+{
+  namespace Signal
+  {
+    /**
+     * 8 bits code for a pulse length: codes 0..63 are the lengths themselves, codes 64..255 are log spaced
+     * up to 65535, about 3.7% apart. A decoded length is thus within 1.9% of the stored one, which is well
+     * below the tolerance of the plugins, while small values (markers in Pulses[0], Multiply based lengths)
+     * are stored exactly.
+     * */
+    namespace PulseCodec
+    {
+      extern const uint16_t decodeTable[256];
+
+      inline uint16_t decode(uint8_t code) { return decodeTable[code]; }
+      /// Code of the nearest decodable length, may be called from an interrupt
+      uint8_t encode(uint16_t length);
+    }
+
+    /**
+     * Read only view on compact pulses, what the decoding helpers of 7_Utils take.
+     * */
+    class CompactPulsesView
+    {
+    public:
+      explicit CompactPulsesView(const uint8_t *codes) : codes(codes) {}
+      inline uint16_t operator[](int index) const { return PulseCodec::decode(codes[index]); }
+      inline bool operator==(const CompactPulsesView &other) const { return codes == other.codes; }
+      /// the codes read from index 0, see PULSES_VIEW_STORAGE
+      inline const uint8_t *storage() const { return codes; }
+
+    private:
+      const uint8_t *codes;
+    };
+
+    /**
+     * Drop in replacement for "uint16_t Pulses[Size]" storing one byte per pulse.
+     * Indexing gives a reference which reads and writes lengths in the same unit as before.
+     * Like ShiftablePulses, indexing is relative to shift.
+     * */
+    template <size_t Size>
+    class CompactPulses
+    {
+    public:
+      class Reference
+      {
+      public:
+        explicit Reference(uint8_t &code) : code(code) {}
+        inline operator uint16_t() const { return PulseCodec::decode(code); }
+        inline Reference &operator=(uint16_t length)
+        {
+          code = PulseCodec::encode(length);
+          return *this;
+        }
+        inline Reference &operator=(const Reference &other)
+        {
+          code = other.code;
+          return *this;
+        }
+
+      private:
+        uint8_t &code;
+      };
+
+      inline Reference operator[](int index) { return Reference(codes[shift + index]); }
+      inline uint16_t operator[](int index) const { return PulseCodec::decode(codes[shift + index]); }
+      inline operator CompactPulsesView() const { return CompactPulsesView(codes + shift); }
+
+      uint8_t codes[Size];
+      uint16_t shift = 0;
+    };
+
+    /**
+     * Drop in replacement for "float Rssis[Size]" storing whole dBm in one byte.
+     * Like ShiftablePulses, indexing is relative to shift.
+     * */
+    template <size_t Size>
+    class CompactRssis
+    {
+    public:
+      class Reference
+      {
+      public:
+        explicit Reference(int8_t &value) : value(value) {}
+        inline operator float() const { return value; }
+        inline Reference &operator=(float rssi)
+        {
+          value = (rssi <= -128) ? -128 : (rssi >= 127) ? 127 : (int8_t)lroundf(rssi);
+          return *this;
+        }
+
+      private:
+        int8_t &value;
+      };
+
+      inline Reference operator[](int index) { return Reference(values[shift + index]); }
+      inline float operator[](int index) const { return values[shift + index]; }
+
+      int8_t values[Size];
+      uint16_t shift = 0;
+    };
+
+    /**
+     * "float Rssis[Size]" shifted along with the pulses, see ShiftablePulses
+     * */
+    template <size_t Size>
+    class ShiftableRssis
+    {
+    public:
+      inline float &operator[](int index) { return values[shift + index]; }
+      inline float operator[](int index) const { return values[shift + index]; }
+
+      float values[Size];
+      uint16_t shift = 0;
+    };
+
+    /**
+     * "uint16_t Pulses[Size]" which can be looked at from a later pulse: while shift is N, index i gives the
+     * stored pulse N + i, and so does the pointer given to the decoding helpers. The stored pulses never move,
+     * see PulsesWindow.
+     * */
+    template <size_t Size>
+    class ShiftablePulses
+    {
+    public:
+      inline uint16_t &operator[](int index) { return values[shift + index]; }
+      inline uint16_t operator[](int index) const { return values[shift + index]; }
+      inline operator uint16_t *() { return values + shift; }
+      inline operator const uint16_t *() const { return values + shift; }
+
+      uint16_t values[Size];
+      uint16_t shift = 0;
+    };
+
+    // PULSES_STORAGE gives the stored pulses from the first one, whatever the shift
+    // PULSES_VIEW_STORAGE gives the stored pulses a PulsesView reads, from its index 0
+#ifdef RFLINK_SIGNAL_COMPACT_PULSES
+    typedef uint8_t PulseCode;   // what is stored for one pulse
+    typedef CompactPulsesView PulsesView; // what a PulseSpan reads the pulses through
+#define PULSES_STORAGE(pulses) ((pulses).codes)
+#define PULSES_VIEW_STORAGE(view) ((view).storage())
+#else
+    typedef uint16_t PulseCode;
+    typedef const uint16_t *PulsesView;
+#define PULSES_STORAGE(pulses) ((pulses).values)
+#define PULSES_VIEW_STORAGE(view) (view)
+#endif
+
+    /**
+     * Called by PulsesWindow once it has moved the shift of the pulses, for what a signal stores beside each pulse.
+     * Nothing by default, see the RawSignalStruct overload.
+     * */
+    template <typename SignalType>
+    inline void shiftAlongPulses(SignalType &signal) {}
+
+    /**
+     * Makes a frame (RawSignal, a queued frame) look, to whoever reads it (plugins), as if it started "first" pulses later, without moving any pulse.
+     * Pulses[0] of the window, a marker for the plugins, reads 0 like on a new frame.
+     * The frame is put back as it was when the window goes out of scope.
+     * @param first must be even, so that the window starts on a mark like the frame
+     * */
+    template <typename SignalType>
+    class PulsesWindow
+    {
+    public:
+      PulsesWindow(SignalType &signal, int first)
+          : signal(signal), number(signal.Number), shift(signal.Pulses.shift),
+            marker(PULSES_STORAGE(signal.Pulses)[signal.Pulses.shift + first])
+      {
+        signal.Pulses.shift += first;
+        shiftAlongPulses(signal);
+        signal.Number -= first;
+        PULSES_STORAGE(signal.Pulses)[signal.Pulses.shift] = 0;
+      }
+      ~PulsesWindow()
+      {
+        PULSES_STORAGE(signal.Pulses)[signal.Pulses.shift] = marker;
+        signal.Pulses.shift = shift;
+        shiftAlongPulses(signal);
+        signal.Number = number;
+      }
+
+    private:
+      SignalType &signal;
+      const int number;
+      const uint16_t shift;
+      const PulseCode marker;
+    };
+
+  } // namespace Signal
+} // namespace RFLink
+
+#endif // _16_PulseStorage_H_
@@ -0,0 +1,196 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "RFLink.h"
+#include "17_NoiseFloor.h"
+#include "1_Radio.h"
+#include "2_Signal.h"
+
+namespace RFLink
+{
+  namespace NoiseFloor
+  {
+    namespace params
+    {
+      bool enabled = false;
+      unsigned long int margin_dB = NOISE_FLOOR_MARGIN_DB;
+    }
+
+    namespace runtime
+    {
+      float floor_dBm = -9999.0F;
+      float spread_dB = 0;
+      float quietestFloor_dBm = -9999.0F;
+      uint8_t appliedThreshold = 0;
+    }
+
+    const char json_name_enabled[] = "noise_floor_enabled";
+    const char json_name_margin[] = "noise_floor_margin";
+
+    Config::ConfigItem configItems[] = {
+        Config::ConfigItem(json_name_enabled, Config::SectionId::Radio_id, false, paramsUpdatedCallback),
+        Config::ConfigItem(json_name_margin, Config::SectionId::Radio_id, NOISE_FLOOR_MARGIN_DB, paramsUpdatedCallback),
+        Config::ConfigItem()};
+
+    struct Window
+    {
+      int8_t floor_dBm;
+      uint8_t spread_dB;
+    };
+
+    static int8_t samples[NOISE_FLOOR_WINDOW_SAMPLES];
+    static byte samplesCount = 0;
+    static Window windows[NOISE_FLOOR_WINDOWS];
+    static byte windowsCount = 0;
+    static byte nextWindow = 0;
+    static unsigned long lastSample_ms = 0;
+
+    void paramsUpdatedCallback()
+    {
+      refreshParametersFromConfig();
+    }
+
+    static void restoreDefaults()
+    {
+      Signal::runtime::rssiGapEarly_dB = RSSI_GAP_EARLY_DB;
+      Signal::runtime::rssiGapLongPulse_dB = RSSI_GAP_LONG_PULSE_DB;
+      Signal::runtime::rssiGapMin_dBm = -9999.0F;
+      if (runtime::appliedThreshold != 0)
+      {
+        Radio::setOokThreshold(Radio::getConfiguredOokThreshold());
+        runtime::appliedThreshold = 0;
+      }
+    }
+
+    void refreshParametersFromConfig()
+    {
+      Config::ConfigItem *item;
+
+      item = Config::findConfigItem(json_name_enabled, Config::SectionId::Radio_id);
+      if (item->getBoolValue() != params::enabled)
+      {
+        params::enabled = item->getBoolValue();
+        if (!params::enabled)
+          restoreDefaults();
+      }
+
+      item = Config::findConfigItem(json_name_margin, Config::SectionId::Radio_id);
+      if (item->getUnsignedLongIntValue() != params::margin_dB)
+      {
+        params::margin_dB = item->getUnsignedLongIntValue();
+        if (params::margin_dB > NOISE_FLOOR_MAX_MARGIN_DB)
+        {
+          Serial.println(F("Invalid noise_floor_margin provided, resetting to default value"));
+          item->setLongIntValue(item->getLongIntDefaultValue());
+          params::margin_dB = item->getUnsignedLongIntValue();
+        }
+      }
+    }
+
+    void setup()
+    {
+      refreshParametersFromConfig();
+    }
+
+    static void applyPolicy()
+    {
+      Signal::runtime::rssiGapEarly_dB = max((float)RSSI_GAP_EARLY_DB, runtime::spread_dB);
+      Signal::runtime::rssiGapLongPulse_dB = max((float)RSSI_GAP_LONG_PULSE_DB, runtime::spread_dB / 2);
+      Signal::runtime::rssiGapMin_dBm = runtime::floor_dBm + params::margin_dB;
+
+      const float step_dB = Radio::getOokThresholdStep_dB();
+      if (step_dB == 0)
+        return;
+
+      // also programmed again when nothing changed, the transceiver may have been initialized in between.
+      // Kept within what the radio config accepts for rssi_thres_value
+      long threshold = Radio::getConfiguredOokThreshold() + lroundf((runtime::floor_dBm - runtime::quietestFloor_dBm) / step_dB);
+      threshold = constrain(threshold, 1, RSSI_THRESHOLD_VALUE_MAX);
+      if (Radio::setOokThreshold(threshold))
+        runtime::appliedThreshold = threshold;
+    }
+
+    /**
+     * Sorts the samples of the window which has just ended and keeps its percentiles
+     * */
+    static void closeWindow()
+    {
+      // insertion sort, a window is small
+      for (byte i = 1; i < NOISE_FLOOR_WINDOW_SAMPLES; i++)
+      {
+        int8_t sample = samples[i];
+        int j = i - 1;
+        for (; j >= 0 && samples[j] > sample; j--)
+          samples[j + 1] = samples[j];
+        samples[j + 1] = sample;
+      }
+
+      Window &window = windows[nextWindow];
+      window.floor_dBm = samples[NOISE_FLOOR_WINDOW_SAMPLES * NOISE_FLOOR_PERCENTILE / 100];
+      window.spread_dB = samples[NOISE_FLOOR_WINDOW_SAMPLES * NOISE_FLOOR_SPREAD_PERCENTILE / 100] - window.floor_dBm;
+      nextWindow = (nextWindow + 1) % NOISE_FLOOR_WINDOWS;
+      if (windowsCount < NOISE_FLOOR_WINDOWS)
+        windowsCount++;
+
+      long floorTotal = 0;
+      long spreadTotal = 0;
+      for (byte i = 0; i < windowsCount; i++)
+      {
+        floorTotal += windows[i].floor_dBm;
+        spreadTotal += windows[i].spread_dB;
+      }
+      runtime::floor_dBm = (float)floorTotal / windowsCount;
+      runtime::spread_dB = (float)spreadTotal / windowsCount;
+      if (runtime::quietestFloor_dBm < -9000.0F || runtime::floor_dBm < runtime::quietestFloor_dBm)
+        runtime::quietestFloor_dBm = runtime::floor_dBm;
+
+      if (params::enabled)
+        applyPolicy();
+    }
+
+    void loop()
+    {
+      if (millis() - lastSample_ms < NOISE_FLOOR_SAMPLE_INTERVAL_MS)
+        return;
+      lastSample_ms = millis();
+
+      if (!Radio::hardwareProperlyInitialized || Radio::current_State != Radio::States::Radio_RX)
+        return;
+      if (Signal::AsyncSignalScanner::isEnabled() && Signal::AsyncSignalScanner::isCapturing())
+        return; // that would be the signal, not the noise
+
+      float rssi = Radio::getCurrentRssi();
+      if (rssi < -127.0F || rssi > 0.0F)
+        return; // no RSSI on this hardware
+
+      samples[samplesCount++] = (int8_t)lroundf(rssi);
+      if (samplesCount < NOISE_FLOOR_WINDOW_SAMPLES)
+        return;
+
+      samplesCount = 0;
+      closeWindow();
+    }
+
+    void getStatusJsonString(JsonObject &output)
+    {
+      auto &&noise = output.createNestedObject("noise_floor");
+      noise[F("enabled")] = params::enabled;
+      if (windowsCount == 0)
+        return;
+      noise[F("floor_dbm")] = runtime::floor_dBm;
+      noise[F("spread_db")] = runtime::spread_dB;
+      noise[F("quietest_floor_dbm")] = runtime::quietestFloor_dBm;
+      if (params::enabled)
+      {
+        noise[F("ook_threshold_db")] = runtime::appliedThreshold * Radio::getOokThresholdStep_dB();
+        noise[F("rssi_gap_early_db")] = Signal::runtime::rssiGapEarly_dB;
+        noise[F("rssi_gap_long_pulse_db")] = Signal::runtime::rssiGapLongPulse_dB;
+        noise[F("rssi_gap_min_dbm")] = Signal::runtime::rssiGapMin_dBm;
+      }
+    }
+  }
+}
@@ -0,0 +1,61 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _17_NoiseFloor_H_
+#define _17_NoiseFloor_H_
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "11_Config.h"
+
+#define NOISE_FLOOR_SAMPLE_INTERVAL_MS 100 // one RSSI read while no signal is being captured
+#define NOISE_FLOOR_WINDOW_SAMPLES 50      // samples per window, 5 seconds
+#define NOISE_FLOOR_WINDOWS 12             // windows averaged into the noise floor, one minute
+#define NOISE_FLOOR_PERCENTILE 20          // of the samples of a window, below it transmitters hardly matter
+#define NOISE_FLOOR_SPREAD_PERCENTILE 80   // the spread of the noise goes from the above percentile to this one
+#define NOISE_FLOOR_MARGIN_DB 6            // a RSSI rise must reach this far above the floor to be a signal
+#define NOISE_FLOOR_MAX_MARGIN_DB 64
+
+namespace RFLink
+{
+  /**
+   * Estimates the noise floor from the RSSI read while the receiver hears no signal,
+   * and when enabled, makes the receiver sensitivity follow it:
+   * - the OOK threshold of the transceiver is raised by how far the floor is above the quietest one seen since boot,
+   *   the configured rssi_thres_value being right for the quietest band
+   * - the RSSI_Advanced slicers only restart a signal on a RSSI rise above the floor plus noise_floor_margin,
+   *   and larger than the spread of the noise
+   * */
+  namespace NoiseFloor
+  {
+    namespace params
+    {
+      extern bool enabled;
+      extern unsigned long int margin_dB;
+    }
+
+    namespace runtime
+    {
+      extern float floor_dBm;       // -9999 until the first window is complete
+      extern float spread_dB;
+      extern float quietestFloor_dBm;
+      extern uint8_t appliedThreshold; // OOK threshold, in the unit of rssi_thres_value, 0 when the configured one is in use
+    }
+
+    extern Config::ConfigItem configItems[];
+
+    void setup();
+    void paramsUpdatedCallback();
+    void refreshParametersFromConfig();
+    /**
+     * Takes a sample when it is time and the receiver is idle, updates the thresholds at the end of every window
+     * */
+    void loop();
+    void getStatusJsonString(JsonObject &output);
+  }
+}
+
+#endif // _17_NoiseFloor_H_
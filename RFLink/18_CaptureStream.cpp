@@ -0,0 +1,226 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include "18_CaptureStream.h"
+
+#ifndef RFLINK_CAPTURE_STREAM_DISABLED
+#include <WiFiClient.h>
+#include <WiFiServer.h>
+
+static_assert((CAPTURE_STREAM_BUFFER_SIZE & (CAPTURE_STREAM_BUFFER_SIZE - 1)) == 0, "CAPTURE_STREAM_BUFFER_SIZE must be a power of 2");
+#endif
+
+namespace RFLink
+{
+  namespace CaptureStream
+  {
+    size_t encodedSize(const Signal::PulseSpan &frame)
+    {
+      size_t size = CAPTURE_FRAME_HEADER_SIZE;
+      for (int i = 1; i <= frame.Number; i++)
+        size += varintSize((unsigned long)frame.Pulses[i] * frame.Multiply);
+      return size;
+    }
+
+#ifndef RFLINK_CAPTURE_STREAM_DISABLED
+    namespace params
+    {
+      bool enabled = false;
+      unsigned int port;
+    }
+
+    namespace counters
+    {
+      unsigned long int capturedFrames = 0;
+      unsigned long int droppedFrames = 0;
+      unsigned long int sentBytes = 0;
+    }
+
+    // All json variable names
+    const char json_name_enabled[] = "capture_enabled";
+    const char json_name_port[] = "capture_port";
+
+    Config::ConfigItem configItems[] = {
+        Config::ConfigItem(json_name_enabled, Config::SectionId::Serial2Net_id, false, paramsUpdatedCallback),
+        Config::ConfigItem(json_name_port, Config::SectionId::Serial2Net_id, CAPTURE_STREAM_PORT, paramsUpdatedCallback),
+        Config::ConfigItem()};
+
+    static WiFiServer server(CAPTURE_STREAM_PORT);
+    static WiFiClient client;
+    static volatile bool clientConnected = false;
+    static bool serverStarted = false;
+
+    /**
+     * Filled by capture() (decoder), emptied by serverLoop() (main loop), both under the decoder lock
+     * */
+    static uint8_t buffer[CAPTURE_STREAM_BUFFER_SIZE];
+    static size_t head = 0; // next byte to write, grows forever and is masked
+    static size_t tail = 0; // next byte to send
+    static uint16_t sequence = 0;
+
+    struct RingSink
+    {
+      inline void put(uint8_t value)
+      {
+        buffer[head & (CAPTURE_STREAM_BUFFER_SIZE - 1)] = value;
+        head++;
+      }
+    };
+
+    void paramsUpdatedCallback()
+    {
+      refreshParametersFromConfig();
+    }
+
+    static void stopServer()
+    {
+      Signal::AsyncSignalScanner::lockDecoder();
+      clientConnected = false;
+      head = tail = 0;
+      Signal::AsyncSignalScanner::unlockDecoder();
+      client.stop();
+      if (serverStarted)
+      {
+        server.stop();
+        serverStarted = false;
+        Serial.println(F("Capture stream server stopped!"));
+      }
+    }
+
+    static void startServer()
+    {
+      server.begin(params::port);
+      server.setNoDelay(true);
+      serverStarted = true;
+      Serial.printf_P(PSTR("Capture stream server started on port %u\r\n"), params::port);
+    }
+
+    void refreshParametersFromConfig(bool triggerChanges)
+    {
+      Config::ConfigItem *item;
+      bool changesDetected = false;
+
+      item = Config::findConfigItem(json_name_enabled, Config::SectionId::Serial2Net_id);
+      if (item->getBoolValue() != params::enabled)
+      {
+        changesDetected = true;
+        params::enabled = item->getBoolValue();
+      }
+
+      item = Config::findConfigItem(json_name_port, Config::SectionId::Serial2Net_id);
+      if (item->getUnsignedLongIntValue() != params::port)
+      {
+        changesDetected = true;
+        params::port = item->getUnsignedLongIntValue();
+        if (params::port == 0 || params::port > 65535)
+        {
+          Serial.println(F("Invalid capture_port provided, resetting to default value"));
+          item->setLongIntValue(item->getLongIntDefaultValue());
+          params::port = item->getUnsignedLongIntValue();
+        }
+      }
+
+      if (triggerChanges && changesDetected)
+      {
+        Serial.println(F("Capture stream parameters have changed."));
+        stopServer();
+        if (params::enabled)
+          startServer();
+      }
+    }
+
+    void setup()
+    {
+      refreshParametersFromConfig(false);
+      if (params::enabled)
+        startServer();
+    }
+
+    void capture(const Signal::PulseSpan &frame, Signal::EndReasons endReason)
+    {
+      if (!clientConnected)
+        return;
+
+      const size_t size = encodedSize(frame);
+      if (size > CAPTURE_STREAM_BUFFER_SIZE - (head - tail))
+      { // the client will see a gap in the sequence numbers
+        counters::droppedFrames++;
+        sequence++;
+        return;
+      }
+
+      RingSink sink;
+      encodeFrame(frame, endReason, sequence++, sink);
+      counters::capturedFrames++;
+    }
+
+    void serverLoop()
+    {
+      if (!serverStarted)
+        return;
+
+      if (!clientConnected || !client.connected())
+      {
+        WiFiClient newClient = server.available();
+        if (clientConnected)
+        {
+          client.stop();
+          Signal::AsyncSignalScanner::lockDecoder();
+          clientConnected = false;
+          Signal::AsyncSignalScanner::unlockDecoder();
+        }
+        if (!newClient.connected())
+          return;
+        client = newClient;
+        client.setNoDelay(true);
+        Signal::AsyncSignalScanner::lockDecoder();
+        head = tail = 0;
+        clientConnected = true;
+        Signal::AsyncSignalScanner::unlockDecoder();
+        return;
+      }
+
+      static uint8_t chunk[CAPTURE_STREAM_CHUNK_SIZE];
+      size_t length;
+
+      Signal::AsyncSignalScanner::lockDecoder();
+      length = head - tail;
+      if (length > CAPTURE_STREAM_CHUNK_SIZE)
+        length = CAPTURE_STREAM_CHUNK_SIZE;
+      #ifdef ESP8266
+      if (length > (size_t)client.availableForWrite())
+        length = client.availableForWrite();
+      #endif
+      for (size_t i = 0; i < length; i++)
+        chunk[i] = buffer[(tail + i) & (CAPTURE_STREAM_BUFFER_SIZE - 1)];
+      Signal::AsyncSignalScanner::unlockDecoder();
+
+      if (length == 0)
+        return;
+
+      size_t written = client.write(chunk, length);
+
+      Signal::AsyncSignalScanner::lockDecoder();
+      tail += written; // what was not written is sent again next time
+      Signal::AsyncSignalScanner::unlockDecoder();
+      counters::sentBytes += written;
+    }
+
+    void getStatusJsonString(JsonObject &output)
+    {
+      auto &&capture = output.createNestedObject("capture_stream");
+      if (params::enabled)
+        capture[F("status")] = clientConnected ? F("streaming") : F("waiting for client");
+      else
+        capture[F("status")] = F("disabled");
+      capture[F("captured_frames")] = counters::capturedFrames;
+      capture[F("dropped_frames")] = counters::droppedFrames;
+      capture[F("sent_bytes")] = counters::sentBytes;
+      capture[F("buffer_size")] = CAPTURE_STREAM_BUFFER_SIZE;
+    }
+#endif // !RFLINK_CAPTURE_STREAM_DISABLED
+  }
+}
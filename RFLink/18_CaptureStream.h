@@ -0,0 +1,161 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _18_CaptureStream_H_
+#define _18_CaptureStream_H_
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "RFLink.h"
+#include "2_Signal.h"
+#include "11_Config.h"
+
+#if defined(RFLINK_NATIVE_BUILD) || !defined(RFLINK_WIFI_ENABLED) || defined(RFLINK_SERIAL2NET_DISABLED)
+#define RFLINK_CAPTURE_STREAM_DISABLED // only the frame encoder is compiled
+#endif
+
+#ifndef CAPTURE_STREAM_PORT
+#define CAPTURE_STREAM_PORT 1901
+#endif
+#ifndef CAPTURE_STREAM_BUFFER_SIZE
+#ifdef ESP32
+#define CAPTURE_STREAM_BUFFER_SIZE 8192 // must be a power of 2, frames waiting to be sent
+#else
+#define CAPTURE_STREAM_BUFFER_SIZE 2048
+#endif
+#endif
+#define CAPTURE_STREAM_CHUNK_SIZE 512   // bytes written to the client per main loop
+
+#define CAPTURE_FRAME_MAGIC_0 'R'
+#define CAPTURE_FRAME_MAGIC_1 'F'
+#define CAPTURE_FRAME_VERSION 1
+#define CAPTURE_FRAME_HEADER_SIZE 15
+#define CAPTURE_FRAME_MAX_SIZE (CAPTURE_FRAME_HEADER_SIZE + 4 * RAW_BUFFER_SIZE) // pulses below 2^28us
+
+namespace RFLink
+{
+  /**
+   * Binary stream of every frame given to the decoder, for continuous recording of the RF traffic.
+   *
+   * Each frame, little endian:
+   *   0  'R' 'F'
+   *   2  version (1)
+   *   3  uint16 length of the pulses that follow the header, in bytes
+   *   5  uint16 sequence number, a gap means frames were dropped because the client was too slow
+   *   7  uint32 millis() when the frame was received
+   *  11  int8   RSSI in dBm, -128 if unknown
+   *  12  uint8  end reason (Signal::EndReasons)
+   *  13  uint16 number of pulses
+   *  15  pulses in microseconds, unsigned LEB128 varints (7 bits per byte, lowest first, high bit set on all but the last)
+   *
+   * tools/capture_decoder.py turns a recording back into 20;XX;DEBUG; lines.
+   * */
+  namespace CaptureStream
+  {
+    /// Writes one byte at a time into a flat buffer, remembers if it was too small
+    struct LinearSink
+    {
+      uint8_t *buffer;
+      size_t size;
+      size_t length;
+
+      inline void put(uint8_t value)
+      {
+        if (length < size)
+          buffer[length] = value;
+        length++;
+      }
+      inline bool overflowed() const { return length > size; }
+    };
+
+    inline byte varintSize(unsigned long value)
+    {
+      byte size = 1;
+      while (value >= 0x80)
+      {
+        value >>= 7;
+        size++;
+      }
+      return size;
+    }
+
+    /**
+     * Size of the frame once encoded, header included
+     * */
+    size_t encodedSize(const Signal::PulseSpan &frame);
+
+    /**
+     * Encodes a frame (see above) into any Sink having a put(uint8_t) method
+     * */
+    template <typename Sink>
+    void encodeFrame(const Signal::PulseSpan &frame, Signal::EndReasons endReason, uint16_t sequence, Sink &sink)
+    {
+      const size_t payload = encodedSize(frame) - CAPTURE_FRAME_HEADER_SIZE;
+      const unsigned long time_ms = frame.Time;
+      const int rssi = (frame.rssi < -128.0F || frame.rssi > 127.0F) ? -128 : (int)lroundf(frame.rssi);
+
+      sink.put(CAPTURE_FRAME_MAGIC_0);
+      sink.put(CAPTURE_FRAME_MAGIC_1);
+      sink.put(CAPTURE_FRAME_VERSION);
+      sink.put(payload & 0xFF);
+      sink.put(payload >> 8);
+      sink.put(sequence & 0xFF);
+      sink.put(sequence >> 8);
+      for (byte i = 0; i < 4; i++)
+        sink.put((time_ms >> (8 * i)) & 0xFF);
+      sink.put((uint8_t)(int8_t)rssi);
+      sink.put((uint8_t)endReason);
+      sink.put(frame.Number & 0xFF);
+      sink.put(frame.Number >> 8);
+
+      for (int i = 1; i <= frame.Number; i++)
+      {
+        unsigned long pulse_us = (unsigned long)frame.Pulses[i] * frame.Multiply;
+        while (pulse_us >= 0x80)
+        {
+          sink.put((pulse_us & 0x7F) | 0x80);
+          pulse_us >>= 7;
+        }
+        sink.put(pulse_us);
+      }
+    }
+
+#ifndef RFLINK_CAPTURE_STREAM_DISABLED
+    namespace params
+    {
+      extern bool enabled;
+      extern unsigned int port;
+    }
+
+    namespace counters
+    {
+      extern unsigned long int capturedFrames;
+      extern unsigned long int droppedFrames; // the buffer was full, the client is too slow
+      extern unsigned long int sentBytes;
+    }
+
+    extern Config::ConfigItem configItems[];
+
+    void setup();
+    void paramsUpdatedCallback();
+    void refreshParametersFromConfig(bool triggerChanges = true);
+
+    /**
+     * Queues a frame for the client, if there is one. Only encodes into a RAM buffer, never waits for the network.
+     * Called by the decoder, with the decoder lock held.
+     * */
+    void capture(const Signal::PulseSpan &frame, Signal::EndReasons endReason);
+    /**
+     * Include in your main loop: accepts the client and sends it what was captured
+     * */
+    void serverLoop();
+
+    void getStatusJsonString(JsonObject &output);
+#endif // !RFLINK_CAPTURE_STREAM_DISABLED
+  }
+}
+
+#endif // _18_CaptureStream_H_
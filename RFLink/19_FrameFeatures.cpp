@@ -0,0 +1,114 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "2_Signal.h"
+#include "19_FrameFeatures.h"
+
+namespace RFLink
+{
+  namespace Signal
+  {
+    /**
+     * Statistics and short/long split of Pulses[first], Pulses[first + 2]... up to Pulses[last]:
+     * two means clustering, starting from the middle of min and max
+     * */
+    static void computeLevel(const PulseSpan &frame, int first, int last, PulseStats &stats, uint32_t symbols[])
+    {
+      memset(&stats, 0, sizeof(stats));
+      if (first > last)
+        return;
+
+      stats.min = 0xFFFF;
+      for (int i = first; i <= last; i += 2)
+      {
+        const uint16_t pulse = frame.Pulses[i];
+        if (pulse < stats.min)
+          stats.min = pulse;
+        if (pulse > stats.max)
+          stats.max = pulse;
+        stats.total += pulse;
+        stats.count++;
+      }
+
+      if (stats.max == stats.min || (uint32_t)stats.max * 2 < (uint32_t)stats.min * 3)
+      {
+        // a single cluster, all short (min == max covers pulses of 0, for which the ratio says nothing)
+        stats.threshold = stats.max;
+        stats.shortCount = stats.count;
+        stats.shortCentroid = stats.total / stats.count;
+        stats.shortMax = stats.max;
+        return;
+      }
+
+      uint16_t threshold = ((uint32_t)stats.min + stats.max) / 2;
+      for (byte round = 0; round < FRAME_FEATURES_SPLIT_ROUNDS; round++)
+      {
+        uint32_t shortTotal = 0, longTotal = 0;
+        stats.shortCount = stats.longCount = 0;
+        stats.shortMax = 0;
+        stats.longMin = 0xFFFF;
+        for (int i = first; i <= last; i += 2)
+        {
+          const uint16_t pulse = frame.Pulses[i];
+          if (pulse > threshold)
+          {
+            longTotal += pulse;
+            stats.longCount++;
+            if (pulse < stats.longMin)
+              stats.longMin = pulse;
+          }
+          else
+          {
+            shortTotal += pulse;
+            stats.shortCount++;
+            if (pulse > stats.shortMax)
+              stats.shortMax = pulse;
+          }
+        }
+        // min is at or below threshold and max above, neither cluster should be empty
+        if (stats.shortCount == 0 || stats.longCount == 0)
+          break;
+        stats.shortCentroid = shortTotal / stats.shortCount;
+        stats.longCentroid = longTotal / stats.longCount;
+
+        const uint16_t next = ((uint32_t)stats.shortCentroid + stats.longCentroid) / 2;
+        if (next == threshold || round + 1 == FRAME_FEATURES_SPLIT_ROUNDS)
+          break; // the clusters above are the ones of threshold
+        threshold = next;
+      }
+      stats.threshold = threshold;
+
+      for (int i = first; i <= last; i += 2)
+      {
+        if (frame.Pulses[i] > threshold)
+          symbols[i / 32] |= 1UL << (i % 32);
+      }
+    }
+
+    void computeFrameFeatures(const PulseSpan &frame, FrameFeatures &features)
+    {
+      const int number = min(frame.Number, RAW_BUFFER_SIZE);
+
+      memset(features.symbols, 0, sizeof(uint32_t) * ((number + 1 + 31) / 32));
+      computeLevel(frame, 1, number, features.marks, features.symbols);
+      computeLevel(frame, 2, number - 1, features.gaps, features.symbols);
+
+      features.computed = true;
+    }
+
+    const FrameFeatures &PulseSpan::features() const
+    {
+      static FrameFeatures scratch; // for a span made outside PluginRXCall(), computed at every call
+
+      FrameFeatures &features = featuresCache != nullptr ? *featuresCache : scratch;
+      if (featuresCache == nullptr || !features.computed)
+        computeFrameFeatures(*this, features);
+      return features;
+    }
+
+  } // namespace Signal
+} // namespace RFLink
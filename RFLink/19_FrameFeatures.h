@@ -0,0 +1,67 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _19_FrameFeatures_H_
+#define _19_FrameFeatures_H_
+
+#include <Arduino.h>
+#include "2_Signal.h"
+
+#define FRAME_FEATURES_SPLIT_ROUNDS 4       // refinements of the short/long split, it usually settles in two
+#define FRAME_FEATURES_SYMBOL_WORDS ((RAW_BUFFER_SIZE + 1 + 31) / 32)
+
+namespace RFLink
+{
+  namespace Signal
+  {
+    /**
+     * Statistics of the pulses of one level (the marks or the gaps) of a frame, in the unit of its Pulses.
+     * The pulses are split in two clusters, short and long. If max is below 1.5 times min, or equal to it, they are all short.
+     * */
+    struct PulseStats
+    {
+      uint16_t count;
+      uint16_t min;
+      uint16_t max;
+      uint32_t total;
+      uint16_t threshold;     // pulses above are long, the others short
+      uint16_t shortCount;
+      uint16_t shortCentroid; // mean of the short pulses
+      uint16_t shortMax;      // longest short pulse
+      uint16_t longCount;     // 0 if there is a single cluster
+      uint16_t longCentroid;
+      uint16_t longMin;       // shortest long pulse
+
+      /// true if, for every pulse of the level, (pulse > limit) says the same as FrameFeatures::isLong()
+      inline bool splitAt(uint16_t limit) const
+      {
+        return longCount == 0 ? max <= limit : shortMax <= limit && longMin > limit;
+      }
+    };
+
+    /**
+     * What the plugins would otherwise each compute on every frame, computed once per frame by PulseSpan::features().
+     * Lets a plugin reject a frame without looking at its pulses (min, max...), and reuse the short/long classification.
+     * */
+    struct FrameFeatures
+    {
+      bool computed;
+      PulseStats marks;         // Pulses[1], Pulses[3]...
+      PulseStats gaps;          // Pulses[2], Pulses[4]... but the gap ending the frame, Pulses[Number] when Number is even
+      uint32_t symbols[FRAME_FEATURES_SYMBOL_WORDS]; // bit i set if Pulses[i] is long for its level
+
+      inline bool isLong(int index) const { return (symbols[index / 32] >> (index % 32)) & 1; }
+    };
+
+    /**
+     * Fills features from the pulses of frame, a few passes over them
+     * */
+    void computeFrameFeatures(const PulseSpan &frame, FrameFeatures &features);
+
+  } // namespace Signal
+} // namespace RFLink
+
+#endif // _19_FrameFeatures_H_
@@ -311,7 +311,7 @@ namespace RFLink { namespace Radio  {
       }
       else {
         value = item->getLongIntValue();
-        if (value <= 0 || value > 128 ) {
+        if (value <= 0 || value > RSSI_THRESHOLD_VALUE_MAX ) {
           Serial.println(F("Invalid RssiFixedThresholdValue provided, resetting to default value"));
           if(item->canBeNull) {
             item->deleteJsonRecord();
@@ -947,6 +947,45 @@ namespace RFLink { namespace Radio  {
       return -9999.0F;
     }
 
+    uint8_t getConfiguredOokThreshold() {
+      #ifndef RFLINK_NO_RADIOLIB_SUPPORT
+      if(params::fixedRssiThreshold != RssiFixedThresholdValue_undefined)
+        return params::fixedRssiThreshold;
+      if(hardware == HardwareType::HW_RFM69CW_t || hardware == HardwareType::HW_RFM69HCW_t)
+        return RssiFixedThresholdValue_default_RFM69;
+      return RssiFixedThresholdValue_default_SX127X;
+      #else
+      return 0;
+      #endif
+    }
+
+    float getOokThresholdStep_dB() {
+      #ifndef RFLINK_NO_RADIOLIB_SUPPORT
+      if(hardware == HardwareType::HW_SX1278_t || hardware == HardwareType::HW_SX1276_t)
+        return 0.5F;
+      if(hardware == HardwareType::HW_RFM69CW_t || hardware == HardwareType::HW_RFM69HCW_t)
+        return 1.0F;
+      #endif
+
+      return 0;
+    }
+
+    bool setOokThreshold(uint8_t threshold) {
+      #ifndef RFLINK_NO_RADIOLIB_SUPPORT
+      if(!hardwareProperlyInitialized)
+        return false;
+      // written as is, like rssi_thres_value by the initialize_ functions
+      if(hardware == HardwareType::HW_SX1278_t)
+        return radio_SX1278->setOokFixedOrFloorThreshold(threshold) == 0;
+      if(hardware == HardwareType::HW_SX1276_t)
+        return radio_SX1276->setOokFixedOrFloorThreshold(threshold) == 0;
+      if(hardware == HardwareType::HW_RFM69CW_t || hardware == HardwareType::HW_RFM69HCW_t)
+        return radio_RFM69->setOokFixedThreshold(threshold) == 0;
+      #endif
+
+      return false;
+    }
+
     void initializeHardware(HardwareType newHardware, bool force) {
 
       if(newHardware == hardware && !force && hardwareProperlyInitialized) {
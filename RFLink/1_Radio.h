@@ -13,6 +13,7 @@
 
 #define TRANSMITTER_STABLE_DELAY_US 500 // 500        // Delay to let the transmitter become stable (Note: Aurel RTX MID needs 500µS/0,5ms).
 #define PULLUP_RF_RX_DATA_0 false       // false      // Sometimes a pullup in needed on RX data pin
+#define RSSI_THRESHOLD_VALUE_MAX 128    // Highest rssi_thres_value accepted, the lowest is 1
 
 #undef BUILTIN_LED
 #define BUILTIN_LED 9
@@ -283,6 +284,21 @@ namespace RFLink { namespace Radio {
      */
     float getCurrentRssi();
 
+    /**
+     * Threshold of the OOK demodulator (the floor one in Peak mode), as set by rssi_thres_value or the hardware default.
+     * In the unit of the register, like rssi_thres_value, see getOokThresholdStep_dB().
+     * */
+    uint8_t getConfiguredOokThreshold();
+    /**
+     * @return dB per unit of the OOK threshold: 0.5 on the SX127x, 1 on the RFM69, 0 if the transceiver has no such threshold
+     * */
+    float getOokThresholdStep_dB();
+    /**
+     * Programs the OOK demodulator threshold, in the unit of rssi_thres_value, the configuration is left untouched.
+     * @return false if the transceiver has no such threshold
+     * */
+    bool setOokThreshold(uint8_t threshold);
+
     void initializeHardware(HardwareType newHardware, bool force = false);
 
     bool initialize_SX1278();
@@ -0,0 +1,129 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "2_Signal.h"
+#include "19_FrameFeatures.h"
+#include "20_OokDecoder.h"
+
+using namespace RFLink::Signal;
+
+namespace RFLink
+{
+  namespace OokDecoder
+  {
+    /**
+     * True if the pulses of one level of the frame cannot all be data pulses, looking only at the frame features.
+     * Only when the data pulses are all the pulses of their level, there is no conclusion otherwise.
+     * */
+    static bool levelOutOfWindows(const PulseSpan &frame, const Protocol &protocol)
+    {
+      const int lastPulse = protocol.firstPulse + 2 * (protocol.bitsCount - 1);
+      const bool marks = protocol.firstPulse % 2 == 1;
+      // the features leave out the gap ending the frame
+      const int levelLast = marks ? (frame.Number % 2 == 1 ? frame.Number : frame.Number - 1)
+                                  : (frame.Number % 2 == 0 ? frame.Number - 2 : frame.Number - 1);
+      if (protocol.firstPulse > 2 || lastPulse != levelLast)
+        return false;
+
+      const FrameFeatures &features = frame.features();
+      const PulseStats &level = marks ? features.marks : features.gaps;
+      return (uint32_t)level.min * frame.Multiply < protocol.shortPulse.min || (uint32_t)level.max * frame.Multiply > protocol.longPulse.max;
+    }
+
+    static bool decodePulsePairs(const PulseSpan &frame, const Protocol &protocol, uint64_t &bits)
+    {
+      const uint32_t multiply = frame.Multiply;
+      int index = protocol.firstPulse;
+
+      bits = 0;
+      for (byte bit = 1; bit <= protocol.bitsCount; bit++, index += 2)
+      {
+        const uint32_t pulse = frame.Pulses[index] * multiply;
+        bool isLong;
+        if (protocol.shortPulse.contains(pulse))
+          isLong = false;
+        else if (protocol.longPulse.contains(pulse))
+          isLong = true;
+        else
+          return false;
+
+        if (protocol.pairCheck != PairCheck::None)
+        {
+          const uint32_t other = frame.Pulses[index + protocol.otherPulse] * multiply;
+          if (protocol.pairCheck == PairCheck::Opposite)
+          {
+            // a pulse right on the split goes with both
+            if (isLong ? other > protocol.shortPulse.max : other < protocol.shortPulse.max)
+              return false;
+          }
+          else if (!(isLong ? protocol.shortPulse : protocol.longPulse).contains(other))
+            return false;
+        }
+
+        bits = (bits << 1) | (isLong ? protocol.shortBit ^ 1 : protocol.shortBit);
+        if (bit == protocol.headerBits && bits != protocol.header)
+          return false;
+      }
+      return true;
+    }
+
+    static bool decodeManchester(const PulseSpan &frame, const Protocol &protocol, uint64_t &bits)
+    {
+      const uint32_t multiply = frame.Multiply;
+      int index = protocol.firstPulse;
+      byte value = protocol.shortBit;
+
+      bits = 0;
+      for (byte bit = 1; bit <= protocol.bitsCount; bit++)
+      {
+        const uint32_t pulse = frame.Pulses[index] * multiply;
+        if (protocol.shortPulse.contains(pulse))
+        {
+          // the second half of a bit which does not change, followed by the first half of the next one, up to the split
+          if (frame.Pulses[index + 1] * multiply > protocol.longPulse.min)
+            return false;
+          index += 2;
+        }
+        else if (protocol.longPulse.contains(pulse))
+        {
+          value ^= 1;
+          index++;
+        }
+        else
+          return false;
+
+        bits = (bits << 1) | value;
+        if (bit == protocol.headerBits && bits != protocol.header)
+          return false;
+      }
+      return true;
+    }
+
+    bool decode(const PulseSpan &frame, const Protocol &protocol_P, uint64_t &bits)
+    {
+      // most frames are rejected on their length, before copying the descriptor
+      if (frame.Number != (int)pgm_read_word(&protocol_P.pulsesCount))
+        return false;
+
+      Protocol protocol;
+      memcpy_P(&protocol, &protocol_P, sizeof(protocol));
+      if (protocol.preamble.max != 0 && !protocol.preamble.contains(frame.Pulses[1] * (uint32_t)frame.Multiply))
+        return false;
+
+      switch (protocol.encoding)
+      {
+      case Encoding::PulsePairs:
+        if (levelOutOfWindows(frame, protocol))
+          return false;
+        return decodePulsePairs(frame, protocol, bits);
+      case Encoding::Manchester:
+        return decodeManchester(frame, protocol, bits);
+      }
+      return false;
+    }
+  }
+}
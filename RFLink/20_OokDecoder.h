@@ -0,0 +1,124 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _20_OokDecoder_H_
+#define _20_OokDecoder_H_
+
+#include <Arduino.h>
+#include "2_Signal.h"
+
+#define OOK_DECODER_MAX_BITS 64
+
+namespace RFLink
+{
+  /**
+   * One decoding loop for the simple OOK protocols, driven by a descriptor instead of a hand written loop per plugin.
+   * A plugin builds its Protocol at compile time with the constexpr functions below, keeps it in flash (PROGMEM),
+   * and only checks and displays the bits decode() gives back:
+   *
+   *   static constexpr OokDecoder::Protocol Protocol_NNN PROGMEM = OokDecoder::pulsePairs(26, 2, 12, {180, 464}, {570, 850}, 1);
+   *   static_assert(OokDecoder::isValid(Protocol_NNN), "invalid protocol");
+   *
+   *   uint64_t bits;
+   *   if (!OokDecoder::decode(frame, Protocol_NNN, bits))
+   *     return false;
+   * */
+  namespace OokDecoder
+  {
+    enum class Encoding : uint8_t
+    {
+      PulsePairs, // a bit every two pulses, given by the length of its data pulse (PWM in the marks, PPM in the gaps)
+      Manchester, // a long pulse inverts the bit, a pair of short pulses keeps it
+    };
+
+    enum class PairCheck : uint8_t
+    {
+      None,              // the other pulse of a pair is not looked at
+      Opposite,          // the other pulse is long when the data pulse is short, and the other way round, a pulse equal to shortPulse.max is both
+      OppositeInWindows, // same, and the other pulse is within the short or long window
+    };
+
+    /// Pulse lengths in microseconds, bounds included
+    struct Window
+    {
+      uint32_t min;
+      uint32_t max;
+
+      constexpr bool contains(uint32_t length) const { return min <= length && length <= max; }
+    };
+
+    struct Protocol
+    {
+      Encoding encoding;
+      uint16_t pulsesCount; // frame.Number
+      Window preamble;      // length of Pulses[1], not checked when max is 0
+      uint16_t firstPulse;  // index of the first data pulse
+      uint8_t bitsCount;    // up to OOK_DECODER_MAX_BITS, the first one ends up in the highest bit
+      Window shortPulse;
+      Window longPulse;
+      uint8_t shortBit;     // PulsePairs: bit of a short data pulse. Manchester: bit before the first pulse
+      PairCheck pairCheck;  // PulsePairs only
+      int8_t otherPulse;    // PulsePairs: index of the other pulse of a pair, from its data pulse: 1 or -1
+      uint8_t headerBits;   // the first headerBits bits must be header, checked as soon as they are decoded
+      uint32_t header;
+
+      constexpr Protocol withPreamble(Window window) const
+      {
+        return Protocol{encoding, pulsesCount, window, firstPulse, bitsCount, shortPulse, longPulse, shortBit, pairCheck, otherPulse, headerBits, header};
+      }
+
+      constexpr Protocol withHeader(uint8_t bits, uint32_t value) const
+      {
+        return Protocol{encoding, pulsesCount, preamble, firstPulse, bitsCount, shortPulse, longPulse, shortBit, pairCheck, otherPulse, bits, value};
+      }
+    };
+
+    /**
+     * Protocol sending bitsCount bits as pairs of pulses, the data pulses being firstPulse, firstPulse + 2...
+     * */
+    constexpr Protocol pulsePairs(uint16_t pulsesCount, uint16_t firstPulse, uint8_t bitsCount, Window shortPulse, Window longPulse,
+                                  uint8_t shortBit, PairCheck pairCheck = PairCheck::None, int8_t otherPulse = 1)
+    {
+      return Protocol{Encoding::PulsePairs, pulsesCount, Window{0, 0}, firstPulse, bitsCount, shortPulse, longPulse, shortBit, pairCheck, otherPulse, 0, 0};
+    }
+
+    /**
+     * Manchester protocol read from pulse lengths: pulses below split are short, the others long.
+     * The pulse after a short one must not be above split.
+     * */
+    constexpr Protocol manchester(uint16_t pulsesCount, uint16_t firstPulse, uint8_t bitsCount, uint32_t split, uint8_t firstBit)
+    {
+      return Protocol{Encoding::Manchester, pulsesCount, Window{0, 0}, firstPulse, bitsCount, Window{0, split - 1}, Window{split, UINT32_MAX}, firstBit, PairCheck::None, 1, 0, 0};
+    }
+
+    /**
+     * For a static_assert: the windows do not overlap and every pulse decode() reads is within pulsesCount,
+     * so that it does not have to check the indexes
+     * */
+    constexpr bool isValid(const Protocol &protocol)
+    {
+      return protocol.bitsCount >= 1 && protocol.bitsCount <= OOK_DECODER_MAX_BITS &&
+             protocol.headerBits <= protocol.bitsCount && protocol.headerBits <= 32 &&
+             protocol.shortPulse.min <= protocol.shortPulse.max && protocol.shortPulse.max < protocol.longPulse.min &&
+             protocol.longPulse.min <= protocol.longPulse.max &&
+             protocol.preamble.min <= protocol.preamble.max && protocol.firstPulse >= 1 &&
+             (protocol.encoding == Encoding::Manchester
+                  ? protocol.firstPulse + 2 * protocol.bitsCount - 1 <= protocol.pulsesCount
+                  : (protocol.otherPulse == 1 || protocol.otherPulse == -1) && protocol.firstPulse + protocol.otherPulse >= 1 &&
+                        protocol.firstPulse + 2 * (protocol.bitsCount - 1) + (protocol.otherPulse > 0 ? 1 : 0) <= protocol.pulsesCount);
+    }
+
+    /**
+     * Decodes frame according to a protocol
+     * @param protocol_P descriptor, in flash
+     * @param bits decoded bits, the last one in bit 0
+     * @return false if the frame is not of this protocol
+     * */
+    bool decode(const Signal::PulseSpan &frame, const Protocol &protocol_P, uint64_t &bits);
+  }
+}
+
+#endif // _20_OokDecoder_H_
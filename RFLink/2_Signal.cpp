@@ -10,6 +10,13 @@
 #include "2_Signal.h"
 #include "5_Plugin.h"
 #include "4_Display.h"
+#include "14_PulseSource.h"
+#include "15_DedupCache.h"
+#include "18_CaptureStream.h"
+
+#ifdef RFLINK_ASYNC_DECODE_TASK
+#include <esp_timer.h>
+#endif
 
 unsigned long SignalCRC = 0L;   // holds the bitstream value for some plugins to identify RF repeats
 unsigned long SignalCRC_1 = 0L; // holds the previous SignalCRC (for mixed burst protocols)
@@ -24,6 +31,16 @@ namespace RFLink
 
     RawSignalStruct RawSignal = {0, 0, 0, 0, 0UL, false, -9999.0F, EndReasons::Unknown}; // current message
 
+    #ifdef ESP32
+    // noInterrupts() is a no-op on ESP32, a critical section is needed to keep the RX interrupt away
+    static portMUX_TYPE asyncQueueMux = portMUX_INITIALIZER_UNLOCKED;
+    #define ASYNC_QUEUE_LOCK() portENTER_CRITICAL(&asyncQueueMux)
+    #define ASYNC_QUEUE_UNLOCK() portEXIT_CRITICAL(&asyncQueueMux)
+    #else
+    #define ASYNC_QUEUE_LOCK() noInterrupts()
+    #define ASYNC_QUEUE_UNLOCK() interrupts()
+    #endif
+
     #define SLICER_DEFAULT_RFM69 Slicer_enum::Legacy
     #define SLICER_DEFAULT_CC1101 Slicer_enum::Legacy
     #define SLICER_DEFAULT_SX1278 Slicer_enum::RSSI_Advanced
@@ -35,22 +52,54 @@ namespace RFLink
       const char testRFMoveForward[] PROGMEM = "testRFMoveForward";
       const char enableVerboseSignalFetchLoop[] PROGMEM = "enableVerboseSignalFetchLoop";
       const char disableVerboseSignalFetchLoop[] PROGMEM = "disableVerboseSignalFetchLoop";
+      const char isrStats[] PROGMEM = "isrStats";
+      const char resetIsrStats[] PROGMEM = "resetIsrStats";
+      const char latencyStats[] PROGMEM = "latencyStats";
+      const char resetLatencyStats[] PROGMEM = "resetLatencyStats";
+      const char dropStats[] PROGMEM = "dropStats";
+      const char resetDropStats[] PROGMEM = "resetDropStats";
+      const char autotune[] PROGMEM = "autotune";
     }
 
     namespace counters {
       unsigned long int receivedSignalsCount;
       unsigned long int successfullyDecodedSignalsCount;
+      unsigned long int skippedRepeatsCount = 0;
+      unsigned long int votedFramesCount = 0;
+      unsigned long int realignedFramesCount = 0;
+      unsigned long int gatedFrames[GateReasons::GATE_REASONS_EOF] = {0};
+      volatile unsigned long int droppedSignals[DropReasons::DROP_REASONS_EOF] = {0};
+      unsigned long int endedSignals[EndReasons::REASONS_EOF] = {0};
+      volatile unsigned long int droppedPulseCounts[PULSE_COUNT_BUCKETS] = {0};
+      unsigned long int acceptedPulseCounts[PULSE_COUNT_BUCKETS] = {0};
+      volatile SlicerCounters slicers[Slicer_enum::SLICERS_EOF] = {};
+      volatile unsigned long int asyncFrameQueueOverruns = 0;
+      volatile unsigned short int asyncFrameQueueHighWaterMark = 0;
+      unsigned long int asyncEdgeBufferOverruns = 0;
+      unsigned long int asyncDecodeLatency[ASYNC_LATENCY_BUCKETS] = {0};
+      unsigned long int asyncDecodeLatencyMax_us = 0;
+      #ifdef RFLINK_SIGNAL_ISR_STATS
+      volatile unsigned long int asyncIsrCalls = 0;
+      volatile uint32_t asyncIsrCyclesMin = UINT32_MAX;
+      volatile uint32_t asyncIsrCyclesMax = 0;
+      volatile uint64_t asyncIsrCyclesTotal = 0;
+      #endif
     }
 
     namespace runtime {
       bool verboseSignalFetchLoop = false;
       Slicer_enum appliedSlicer = Slicer_enum::Default;
+      PulseSource *pulseSource = &gpioPulseSource;
+      float rssiGapEarly_dB = RSSI_GAP_EARLY_DB;
+      float rssiGapLongPulse_dB = RSSI_GAP_LONG_PULSE_DB;
+      float rssiGapMin_dBm = -9999.0F;
     }
 
     namespace params
     {
       // All json variable names
       bool async_mode_enabled = false;
+      bool async_edge_capture_enabled = false;
       unsigned short int sample_rate;
       unsigned long int min_raw_pulses;
       unsigned long int seek_timeout;
@@ -59,11 +108,22 @@ namespace RFLink
       unsigned long int signal_end_timeout;
       unsigned long int signal_repeat_time;
       unsigned long int scan_high_time;
+      unsigned long int rssi_sample_interval;
+      bool repeat_fingerprint_enabled = true;
+      bool repeat_voting_enabled = false;
+      bool realign_enabled = false;
+      bool noise_gate_enabled = false;
+      unsigned long int noise_gate_max_clusters = NOISE_GATE_MAX_CLUSTERS;
+      unsigned long int noise_gate_max_spread = NOISE_GATE_MAX_SPREAD;     // percent
+      unsigned long int noise_gate_max_outliers = NOISE_GATE_MAX_OUTLIERS; // percent
+      bool autotune_enabled = false;
+      unsigned long int autotune_window;            // seconds
 
       Slicer_enum slicer = Slicer_enum::Default;
     }
 
     const char json_name_async_mode_enabled[] = "async_mode_enabled";
+    const char json_name_async_edge_capture_enabled[] = "async_edge_capture_enabled";
     const char json_name_sample_rate[] = "sample_rate";
     const char json_name_min_raw_pulses[] = "min_raw_pulses";
     const char json_name_seek_timeout[] = "seek_timeout";
@@ -72,10 +132,21 @@ namespace RFLink
     const char json_name_signal_end_timeout[] = "signal_end_timeout";
     const char json_name_signal_repeat_time[] = "signal_repeat_time";
     const char json_name_scan_high_time[] = "scan_high_time";
+    const char json_name_rssi_sample_interval[] = "rssi_sample_interval";
     const char json_name_slicer[] = "slicer";
+    const char json_name_repeat_fingerprint_enabled[] = "repeat_fingerprint_enabled";
+    const char json_name_repeat_voting_enabled[] = "repeat_voting_enabled";
+    const char json_name_realign_enabled[] = "realign_enabled";
+    const char json_name_noise_gate_enabled[] = "noise_gate_enabled";
+    const char json_name_noise_gate_max_clusters[] = "noise_gate_max_clusters";
+    const char json_name_noise_gate_max_spread[] = "noise_gate_max_spread";
+    const char json_name_noise_gate_max_outliers[] = "noise_gate_max_outliers";
+    const char json_name_autotune_enabled[] = "autotune_enabled";
+    const char json_name_autotune_window[] = "autotune_window";
 
     Config::ConfigItem configItems[] = {
             Config::ConfigItem(json_name_async_mode_enabled, Config::SectionId::Signal_id, false, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_async_edge_capture_enabled, Config::SectionId::Signal_id, false, paramsUpdatedCallback),
             Config::ConfigItem(json_name_sample_rate, Config::SectionId::Signal_id, DEFAULT_RAWSIGNAL_SAMPLE_RATE, paramsUpdatedCallback),
             Config::ConfigItem(json_name_min_raw_pulses, Config::SectionId::Signal_id, MIN_RAW_PULSES, paramsUpdatedCallback),
             Config::ConfigItem(json_name_seek_timeout, Config::SectionId::Signal_id, SIGNAL_SEEK_TIMEOUT_MS, paramsUpdatedCallback),
@@ -84,6 +155,16 @@ namespace RFLink
             Config::ConfigItem(json_name_signal_end_timeout, Config::SectionId::Signal_id, SIGNAL_END_TIMEOUT_US, paramsUpdatedCallback),
             Config::ConfigItem(json_name_signal_repeat_time, Config::SectionId::Signal_id, SIGNAL_REPEAT_TIME_MS, paramsUpdatedCallback),
             Config::ConfigItem(json_name_scan_high_time, Config::SectionId::Signal_id, SCAN_HIGH_TIME_MS, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_rssi_sample_interval, Config::SectionId::Signal_id, RSSI_SAMPLE_INTERVAL_US, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_repeat_fingerprint_enabled, Config::SectionId::Signal_id, true, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_repeat_voting_enabled, Config::SectionId::Signal_id, false, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_realign_enabled, Config::SectionId::Signal_id, false, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_noise_gate_enabled, Config::SectionId::Signal_id, false, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_noise_gate_max_clusters, Config::SectionId::Signal_id, NOISE_GATE_MAX_CLUSTERS, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_noise_gate_max_spread, Config::SectionId::Signal_id, NOISE_GATE_MAX_SPREAD, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_noise_gate_max_outliers, Config::SectionId::Signal_id, NOISE_GATE_MAX_OUTLIERS, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_autotune_enabled, Config::SectionId::Signal_id, false, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_autotune_window, Config::SectionId::Signal_id, AUTOTUNE_WINDOW_S, paramsUpdatedCallback),
 
             Config::ConfigItem(json_name_slicer, Config::SectionId::Signal_id, Slicer_enum::Default, paramsUpdatedCallback, true),
 
@@ -107,6 +188,15 @@ namespace RFLink
         params::async_mode_enabled = item->getBoolValue();
       }
 
+      bool edgeCaptureChanged = false;
+      item = Config::findConfigItem(json_name_async_edge_capture_enabled, Config::SectionId::Signal_id);
+      if (item->getBoolValue() != params::async_edge_capture_enabled)
+      {
+        changesDetected = true;
+        edgeCaptureChanged = true;
+        params::async_edge_capture_enabled = item->getBoolValue();
+      }
+
       item = Config::findConfigItem(json_name_sample_rate, Config::SectionId::Signal_id);
       if (item->getLongIntValue() != params::sample_rate)
       {
@@ -163,6 +253,100 @@ namespace RFLink
         params::scan_high_time = item->getLongIntValue();
       }
 
+      item = Config::findConfigItem(json_name_rssi_sample_interval, Config::SectionId::Signal_id);
+      if (item->getUnsignedLongIntValue() != params::rssi_sample_interval)
+      {
+        changesDetected = true;
+        params::rssi_sample_interval = item->getUnsignedLongIntValue();
+      }
+
+      item = Config::findConfigItem(json_name_repeat_fingerprint_enabled, Config::SectionId::Signal_id);
+      if (item->getBoolValue() != params::repeat_fingerprint_enabled)
+      {
+        changesDetected = true;
+        params::repeat_fingerprint_enabled = item->getBoolValue();
+      }
+
+      item = Config::findConfigItem(json_name_repeat_voting_enabled, Config::SectionId::Signal_id);
+      if (item->getBoolValue() != params::repeat_voting_enabled)
+      {
+        changesDetected = true;
+        params::repeat_voting_enabled = item->getBoolValue();
+      }
+
+      item = Config::findConfigItem(json_name_realign_enabled, Config::SectionId::Signal_id);
+      if (item->getBoolValue() != params::realign_enabled)
+      {
+        changesDetected = true;
+        params::realign_enabled = item->getBoolValue();
+      }
+
+      item = Config::findConfigItem(json_name_noise_gate_enabled, Config::SectionId::Signal_id);
+      if (item->getBoolValue() != params::noise_gate_enabled)
+      {
+        changesDetected = true;
+        params::noise_gate_enabled = item->getBoolValue();
+      }
+
+      item = Config::findConfigItem(json_name_noise_gate_max_clusters, Config::SectionId::Signal_id);
+      if (item->getUnsignedLongIntValue() != params::noise_gate_max_clusters)
+      {
+        changesDetected = true;
+        params::noise_gate_max_clusters = item->getUnsignedLongIntValue();
+        if (params::noise_gate_max_clusters < 2)
+        {
+          Serial.println(F("Invalid noise_gate_max_clusters provided, resetting to default value"));
+          item->setLongIntValue(item->getLongIntDefaultValue());
+          params::noise_gate_max_clusters = item->getUnsignedLongIntValue();
+        }
+      }
+
+      item = Config::findConfigItem(json_name_noise_gate_max_spread, Config::SectionId::Signal_id);
+      if (item->getUnsignedLongIntValue() != params::noise_gate_max_spread)
+      {
+        changesDetected = true;
+        params::noise_gate_max_spread = item->getUnsignedLongIntValue();
+        if (params::noise_gate_max_spread == 0 || params::noise_gate_max_spread > 100)
+        {
+          Serial.println(F("Invalid noise_gate_max_spread provided, resetting to default value"));
+          item->setLongIntValue(item->getLongIntDefaultValue());
+          params::noise_gate_max_spread = item->getUnsignedLongIntValue();
+        }
+      }
+
+      item = Config::findConfigItem(json_name_noise_gate_max_outliers, Config::SectionId::Signal_id);
+      if (item->getUnsignedLongIntValue() != params::noise_gate_max_outliers)
+      {
+        changesDetected = true;
+        params::noise_gate_max_outliers = item->getUnsignedLongIntValue();
+        if (params::noise_gate_max_outliers > 100)
+        {
+          Serial.println(F("Invalid noise_gate_max_outliers provided, resetting to default value"));
+          item->setLongIntValue(item->getLongIntDefaultValue());
+          params::noise_gate_max_outliers = item->getUnsignedLongIntValue();
+        }
+      }
+
+      item = Config::findConfigItem(json_name_autotune_enabled, Config::SectionId::Signal_id);
+      if (item->getBoolValue() != params::autotune_enabled)
+      {
+        changesDetected = true;
+        params::autotune_enabled = item->getBoolValue();
+      }
+
+      item = Config::findConfigItem(json_name_autotune_window, Config::SectionId::Signal_id);
+      if (item->getUnsignedLongIntValue() != params::autotune_window)
+      {
+        changesDetected = true;
+        params::autotune_window = item->getUnsignedLongIntValue();
+        if (params::autotune_window == 0)
+        {
+          Serial.println(F("Invalid autotune_window provided, resetting to default value"));
+          item->setLongIntValue(item->getLongIntDefaultValue());
+          params::autotune_window = item->getUnsignedLongIntValue();
+        }
+      }
+
 
       long int value;
       item = Config::findConfigItem(json_name_slicer, Config::SectionId::Signal_id);
@@ -199,6 +383,11 @@ namespace RFLink
         {
           AsyncSignalScanner::startScanning();
         }
+        else if (params::async_mode_enabled && edgeCaptureChanged)
+        { // the other interrupt handler has to be attached
+          AsyncSignalScanner::stopScanning();
+          AsyncSignalScanner::startScanning();
+        }
       }
     }
 
@@ -208,6 +397,42 @@ namespace RFLink
       refreshParametersFromConfig();
     }
 
+    static inline byte IRAM_ATTR pulseCountBucket(unsigned int pulsesCount)
+    {
+      byte bucket = 0;
+      while (pulsesCount > 1 && bucket < PULSE_COUNT_BUCKETS - 1)
+      {
+        pulsesCount >>= 1;
+        bucket++;
+      }
+      return bucket;
+    }
+
+    /**
+     * Counts a signal thrown away by a slicer, nothing is counted while not a single pulse was stored.
+     * Only signals of SIGNAL_DROP_MIN_PULSES or more are counted as dropped, shorter ones are just noise.
+     * */
+    static inline void IRAM_ATTR countDrop(DropReasons reason, unsigned int pulsesCount)
+    {
+      if (pulsesCount == 0)
+        return;
+      counters::droppedPulseCounts[pulseCountBucket(pulsesCount)]++;
+      if (pulsesCount < SIGNAL_DROP_MIN_PULSES)
+        return;
+      counters::droppedSignals[reason]++;
+      if (runtime::appliedSlicer > Slicer_enum::Default && runtime::appliedSlicer < Slicer_enum::SLICERS_EOF)
+        counters::slicers[runtime::appliedSlicer].dropped[reason]++;
+    }
+
+    /**
+     * RSSI_Advanced slicers: a transmitter has started within a long pulse if the RSSI rose by more than delta_dB.
+     * The deltas (6 and 3 dB, found by experimentation) are raised by the noise floor estimator on noisy bands.
+     * */
+    static inline bool isRssiGap(float referenceRssi, float newRssi, float delta_dB)
+    {
+      return referenceRssi + delta_dB < newRssi && newRssi >= runtime::rssiGapMin_dBm;
+    }
+
     boolean FetchSignal_sync()
     {
       // *********************************************************************************
@@ -217,13 +442,14 @@ namespace RFLink
       static unsigned int RawCodeLength;
       static unsigned long PulseLength_us;
       static const bool Start_Level = LOW;
+      PulseSource *const source = runtime::pulseSource;
       // *********************************************************************************
 
-#define RESET_SEEKSTART timeStartSeek_ms = millis();
-#define RESET_TIMESTART timeStartLoop_us = micros();
-#define CHECK_RF ((digitalRead(Radio::pins::RX_DATA) == Start_Level) ^ Toggle)
-#define CHECK_TIMEOUT ((millis() - timeStartSeek_ms) < params::seek_timeout)
-#define GET_PULSELENGTH PulseLength_us = micros() - timeStartLoop_us
+#define RESET_SEEKSTART timeStartSeek_ms = source->millis();
+#define RESET_TIMESTART timeStartLoop_us = source->micros();
+#define CHECK_RF ((source->readLevel() == Start_Level) ^ Toggle)
+#define CHECK_TIMEOUT ((source->millis() - timeStartSeek_ms) < params::seek_timeout)
+#define GET_PULSELENGTH PulseLength_us = source->micros() - timeStartLoop_us
 #define SWITCH_TOGGLE Toggle = !Toggle
 #define STORE_PULSE RawSignal.Pulses[RawCodeLength++] = PulseLength_us / params::sample_rate;
 
@@ -275,6 +501,7 @@ namespace RFLink
         if (PulseLength_us < params::min_pulse_len)
         {
           // NO RawCodeLength++;
+          countDrop(DropReasons::ShortPulse, RawCodeLength);
           return false; // Or break; instead, if you think it may worth it.
         }
 
@@ -286,7 +513,7 @@ namespace RFLink
         }
 
         if(RawCodeLength%2 == 0) {
-          auto newRssi = Radio::getCurrentRssi();
+          auto newRssi = source->readRssi();
           if( RawSignal.rssi+10 < newRssi ) {
             RawCodeLength = 0;
             RawSignal.rssi = newRssi;
@@ -305,13 +532,15 @@ namespace RFLink
         RawSignal.Pulses[RawCodeLength] = params::signal_end_timeout;  // Last element contains the timeout.
         RawSignal.Number = RawCodeLength - 1; // Number of received pulse times (pulsen *2)
         RawSignal.Multiply = params::sample_rate;
-        RawSignal.Time = millis(); // Time the RF packet was received (to keep track of retransmits
+        RawSignal.endReason = RawCodeLength >= RAW_BUFFER_SIZE ? EndReasons::TooLong : EndReasons::SignalEndTimeout;
+        RawSignal.Time = source->millis(); // Time the RF packet was received (to keep track of retransmits
         //Serial.print ("D");
         //Serial.print (RawCodeLength);
         return true;
       }
       else
       {
+        countDrop(DropReasons::TooFewPulses, RawCodeLength);
         RawSignal.Number = 0;
       }
 
@@ -327,17 +556,18 @@ namespace RFLink
       static unsigned int RawCodeLength;
       static unsigned long PulseLength_us;
       static const bool Start_Level = LOW;
+      PulseSource *const source = runtime::pulseSource;
 
       unsigned long gapsTotalLength; // To make statistics on Gaps length and find an earlier end to the signal
       unsigned long averagedGapsLength;
       unsigned long dynamicGapEnd_us;
 
       float longPulseRssiReference = 0.0;    // with high gains, output can remain high forever so RSSI must be checked from time to time
-      int longPulseRssiTimer = 0;
+      RssiSampler rssi(source, params::rssi_sample_interval); // getCurrentRssi() takes 30us, the output is polled in between
       // *********************************************************************************
 
 #ifdef RFLINK_SIGNAL_RSSI_DEBUG
-#define STORE_PULSE (RawSignal.Pulses[RawCodeLength++] = PulseLength_us / params::sample_rate; RawSignal.Rssis[RawCodeLength] = Radio::getCurrentRssi();)
+#define STORE_PULSE (RawSignal.Pulses[RawCodeLength++] = PulseLength_us / params::sample_rate, RawSignal.Rssis[RawCodeLength] = source->readRssi())
 #else
 #undef STORE_PULSE
 #define STORE_PULSE (RawSignal.Pulses[RawCodeLength++] = PulseLength_us / params::sample_rate)
@@ -350,7 +580,7 @@ namespace RFLink
       gapsTotalLength = 0;
       averagedGapsLength = 0;
       dynamicGapEnd_us = 0;
-      RawSignal.Time = micros();
+      RawSignal.Time = source->micros();
       RawSignal.endReason = EndReasons::Unknown;
 
       // ***********************************
@@ -360,7 +590,7 @@ namespace RFLink
 
       while (PulseLength_us < params::min_preamble)
       {
-        longPulseRssiReference = Radio::getCurrentRssi();
+        longPulseRssiReference = rssi.read();
         RawCodeLength = 0;
 
         while (CHECK_RF && CHECK_TIMEOUT) {// wait until output goes LOW
@@ -369,24 +599,20 @@ namespace RFLink
           //that signal will still be scanned. This is helping with very high sensitivity receivers which may see Pulses
           // for a long time
 
-          unsigned long timeBeforeRssi = micros();
-          float newRssi = Radio::getCurrentRssi();
+          float newRssi = rssi.sample();
 
           GET_PULSELENGTH;
 
-          if (PulseLength_us > 150 && longPulseRssiReference + 6 < newRssi) { // 6 empirical value found by experimentation
+          if (PulseLength_us > 150 && isRssiGap(longPulseRssiReference, newRssi, runtime::rssiGapEarly_dB)) {
 
             if(runtime::verboseSignalFetchLoop) {
-              sprintf_P(printBuf,
-                        PSTR("%.4lX LONG Pulse EARLY reset because of RSSI gap within it (refRssi=%.0f newRssi=%.0f length=%lu pos=%u)"),
-                        RawSignal.Time,
-                        longPulseRssiReference,
-                        newRssi,
-                        PulseLength_us,
-                        RawCodeLength);
-              RFLink::sendRawPrint(printBuf, true);
+              LineWriter line;
+              line.printHex(RawSignal.Time, 4).print(F(" LONG Pulse EARLY reset because of RSSI gap within it (refRssi="));
+              line.print(longPulseRssiReference, 0).print(F(" newRssi=")).print(newRssi, 0);
+              line.print(F(" length=")).print(PulseLength_us).print(F(" pos=")).print(RawCodeLength).print(')');
+              line.println();
             }
-            timeStartLoop_us = timeBeforeRssi+130; // 130 empirical value found by experimentation
+            timeStartLoop_us = rssi.getLastRead_us()+130; // 130 empirical value found by experimentation
             longPulseRssiReference = newRssi;
             RawCodeLength = 1; // to restart signal from scratch
           } else {
@@ -410,11 +636,12 @@ namespace RFLink
         SWITCH_TOGGLE;
         if (!CHECK_TIMEOUT){
           if(runtime::verboseSignalFetchLoop) {
-            sprintf_P(printBuf, PSTR("%.4lX Early signal dropped because of seek_timeout (pulseLen=%lu)"),
-                      RawSignal.Time,
-                      PulseLength_us);
-            RFLink::sendRawPrint(printBuf, true);
+            LineWriter line;
+            line.printHex(RawSignal.Time, 4).print(F(" Early signal dropped because of seek_timeout (pulseLen="));
+            line.print(PulseLength_us).print(')');
+            line.println();
           }
+          countDrop(DropReasons::SeekTimeout, RawCodeLength);
           return false;
         }
       }
@@ -429,7 +656,7 @@ namespace RFLink
       RESET_TIMESTART; // next pulse starts now before we do anything else
       STORE_PULSE;
 
-      RawSignal.rssi = Radio::getCurrentRssi();
+      RawSignal.rssi = rssi.read();
       if(longPulseRssiReference > RawSignal.rssi)
         RawSignal.rssi = longPulseRssiReference;
 
@@ -440,8 +667,7 @@ namespace RFLink
       while (RawCodeLength < RAW_BUFFER_SIZE)
       {
         if(Toggle) {
-          longPulseRssiTimer = 0;
-          longPulseRssiReference = Radio::getCurrentRssi();
+          longPulseRssiReference = rssi.sample();
         }
 
         while (CHECK_RF)
@@ -452,27 +678,18 @@ namespace RFLink
           if (dynamicGapEnd_us > 200 && !Toggle &&  PulseLength_us > dynamicGapEnd_us) // if this is a gap and we've over the dynamic limit
             break;
 
-          //
-          if( /*RawCodeLength == 1 &&*/ Toggle /*&& (micros() - timeStartLoop_us) / 80 > longPulseRssiTimer*/) { // let's run it every 80 us since getCurrentRssi() takes 30us to run
-            longPulseRssiTimer++;
-            /*sprintf_P(printBuf, PSTR("(pin=%i)"),
-                      (int) digitalRead(Radio::pins::RX_DATA));
-            RFLink::sendRawPrint(printBuf, true);*/
-            float newRssi = Radio::getCurrentRssi();
-            if (longPulseRssiTimer > 100 && longPulseRssiReference + 3 < newRssi) {
+          if(Toggle) { // the RSSI is only read every rssi_sample_interval, the output is polled at full speed in between
+            float newRssi = rssi.sample();
+            if (PulseLength_us > LONG_PULSE_RSSI_CHECK_US && isRssiGap(longPulseRssiReference, newRssi, runtime::rssiGapLongPulse_dB)) {
               if(runtime::verboseSignalFetchLoop) {
-                sprintf_P(printBuf,
-                          PSTR("%.4lX LONG Pulse resets signal because of RSSI gap within it (refRssi=%.0f newRssi=%.0f length=%lu toggle=%i pos=%u)"),
-                          RawSignal.Time,
-                          longPulseRssiReference,
-                          newRssi,
-                          micros() - timeStartLoop_us,
-                          (int) Toggle,
-                          RawCodeLength);
-                RFLink::sendRawPrint(printBuf, true);
+                LineWriter line;
+                line.printHex(RawSignal.Time, 4).print(F(" LONG Pulse resets signal because of RSSI gap within it (refRssi="));
+                line.print(longPulseRssiReference, 0).print(F(" newRssi=")).print(newRssi, 0);
+                line.print(F(" length=")).print(source->micros() - timeStartLoop_us);
+                line.print(F(" toggle=")).print((int) Toggle).print(F(" pos=")).print(RawCodeLength).print(')');
+                line.println();
               }
-              timeStartLoop_us = micros() + 30;
-              longPulseRssiTimer = 0;
+              timeStartLoop_us = source->micros() + 30;
               longPulseRssiReference = newRssi;
               RawSignal.rssi = newRssi;
               gapsTotalLength = 0;
@@ -500,8 +717,9 @@ namespace RFLink
               if( ((unsigned long)RawSignal.Pulses[RawCodeLength-1])*(unsigned long)params::sample_rate >= ((unsigned long)averagedGapsLength)*(unsigned long)150/(unsigned long)100 ) {
                 // if previous Gap is 1.5x the average of Gaps we will try to decode still!
                 if(runtime::verboseSignalFetchLoop) {
-                  sprintf_P(printBuf, PSTR("%.4lX attempted noise filter"), RawSignal.Time);
-                  RFLink::sendRawPrint(printBuf, true);
+                  LineWriter line;
+                  line.printHex(RawSignal.Time, 4).print(F(" attempted noise filter"));
+                  line.println();
                 }
                 RawSignal.endReason = EndReasons::AttemptedNoiseFilter;
                 break;
@@ -509,9 +727,12 @@ namespace RFLink
             }
           }
           if(runtime::verboseSignalFetchLoop) {
-            sprintf_P(printBuf, PSTR("%.4lX Dropped signal due to short pulse (RawCodeLength=%u, pulseLen=%lu)"), RawSignal.Time, RawCodeLength, PulseLength_us);
-            RFLink::sendRawPrint(printBuf, true);
+            LineWriter line;
+            line.printHex(RawSignal.Time, 4).print(F(" Dropped signal due to short pulse (RawCodeLength=")).print(RawCodeLength);
+            line.print(F(", pulseLen=")).print(PulseLength_us).print(')');
+            line.println();
           }
+          countDrop(DropReasons::ShortPulse, RawCodeLength);
           return false; // it seems to be noise so we're out !
         }
 
@@ -519,11 +740,10 @@ namespace RFLink
         {
           STORE_PULSE;
           if(runtime::verboseSignalFetchLoop) {
-            sprintf_P(printBuf,
-                      PSTR("%.4lX Ended signal because of dynamic gap length reached (pulse=%lu dynamicGap=%lu pos=%i)"),
-                      RawSignal.Time,
-                      PulseLength_us, dynamicGapEnd_us, (int) RawCodeLength);
-            RFLink::sendRawPrint(printBuf, true);
+            LineWriter line;
+            line.printHex(RawSignal.Time, 4).print(F(" Ended signal because of dynamic gap length reached (pulse=")).print(PulseLength_us);
+            line.print(F(" dynamicGap=")).print(dynamicGapEnd_us).print(F(" pos=")).print((int) RawCodeLength).print(')');
+            line.println();
           }
           RawSignal.endReason = EndReasons::DynamicGapLengthReached;
           break;
@@ -536,11 +756,10 @@ namespace RFLink
             STORE_PULSE;
 
           if(runtime::verboseSignalFetchLoop) {
-            sprintf_P(printBuf, PSTR("%.4lX Signal ended because of signal_end_timeout (toggle=%i pos=%i)"),
-                      RawSignal.Time,
-                      (int) Toggle,
-                      (int) RawCodeLength);
-            RFLink::sendRawPrint(printBuf, true);
+            LineWriter line;
+            line.printHex(RawSignal.Time, 4).print(F(" Signal ended because of signal_end_timeout (toggle=")).print((int) Toggle);
+            line.print(F(" pos=")).print((int) RawCodeLength).print(')');
+            line.println();
           }
           RawSignal.endReason = EndReasons::SignalEndTimeout;
           break;
@@ -573,7 +792,7 @@ namespace RFLink
         RawSignal.Pulses[RawCodeLength] = params::signal_end_timeout;  // Last element contains the timeout.
         RawSignal.Number = RawCodeLength - 1; // Number of received pulse times (pulse *2)
         RawSignal.Multiply = params::sample_rate;
-        RawSignal.Time = millis(); // Time the RF packet was received (to keep track of retransmits
+        RawSignal.Time = source->millis(); // Time the RF packet was received (to keep track of retransmits
         //Serial.print ("D");
         //Serial.print (RawCodeLength);
         return true;
@@ -581,250 +800,1537 @@ namespace RFLink
       else
       {
         if(runtime::verboseSignalFetchLoop) {
-          sprintf_P(printBuf, PSTR("%.4lX Dropped signal because it's too short (RawCodeLength=%u)"), RawSignal.Time, RawCodeLength);
-          RFLink::sendRawPrint(printBuf, true);
+          LineWriter line;
+          line.printHex(RawSignal.Time, 4).print(F(" Dropped signal because it's too short (RawCodeLength=")).print(RawCodeLength).print(')');
+          line.println();
         }
+        countDrop(DropReasons::TooFewPulses, RawCodeLength);
         RawSignal.Number = 0;
       }
 
       return false;
     }
 
-    boolean ScanEvent()
+    bool fetchSignal()
     {
-      if (Radio::current_State != Radio::States::Radio_RX)
-        return false;
+      if(runtime::appliedSlicer == Slicer_enum::Legacy)
+        return FetchSignal_sync();
+      else if (runtime::appliedSlicer == Slicer_enum::RSSI_Advanced)
+        return FetchSignal_sync_rssi();
 
-      if (!params::async_mode_enabled)
-      {
+      sprintf_P(printBuf, PSTR("Invalid slicer selected (%i)"), (int) runtime::appliedSlicer);
+      return false;
+    }
 
-        unsigned long Timer = millis() + params::scan_high_time;
+    unsigned long computeFingerprint(const PulseSpan &frame)
+    {
+      // first and last pulses are left out: the slicer may cut into the former and the latter ends on a timeout
+      if (frame.Number < 4)
+        return 0;
 
-        while (Timer > millis()) // || RepeatingTimer > millis())
-        {
-          bool success = false;
+      uint16_t shortest = 0xFFFF;
+      for (int i = 2; i < frame.Number; i++)
+      {
+        if (frame.Pulses[i] != 0 && frame.Pulses[i] < shortest)
+          shortest = frame.Pulses[i];
+      }
+      if (shortest == 0xFFFF)
+        return 0;
 
-          if(runtime::appliedSlicer == Slicer_enum::Legacy)
-            success = FetchSignal_sync();
-          else if (runtime::appliedSlicer == Slicer_enum::RSSI_Advanced)
-            success = FetchSignal_sync_rssi();
-          else {
-            sprintf_P(printBuf, PSTR("Invalid slicer selected (%i)"), (int) runtime::appliedSlicer);
-          }
+      // FNV-1a over the pulse count and the pulses in units of the shortest one
+      uint32_t hash = 2166136261UL;
+      hash ^= (uint32_t)frame.Number;
+      hash *= 16777619UL;
 
-          if (success)
-          { // RF: *** data start ***
-            counters::receivedSignalsCount++;
-            if (PluginRXCall(0, 0))
-            { // Check all plugins to see which plugin can handle the received signal.
-              counters::successfullyDecodedSignalsCount++;
-              RepeatingTimer = millis() + params::signal_repeat_time;
-              //auto responseLength = strlen(pbuffer);
-              //if(responseLength>1)
-              //  sprintf(&pbuffer[responseLength-2], "RSSI=%i;\r\n", (int)RawSignal.rssi);
-              return true;
-            }
-          }
-        } // while
-        return false;
+      for (int i = 2; i < frame.Number; i++)
+      {
+        uint32_t units = ((uint32_t)frame.Pulses[i] * 2 + shortest) / (2 * (uint32_t)shortest);
+        if (units > 15) // sync gaps and such, only their presence matters
+          units = 15;
+        hash ^= units;
+        hash *= 16777619UL;
       }
 
-      // here we are in ASYNC mode
+      return hash != 0 ? hash : 1;
+    }
 
-      if (!RawSignal.readyForDecoder)
+    namespace RepeatFingerprints
+    {
+      struct DecodedFrame
       {
-        if (AsyncSignalScanner::nextPulseTimeoutTime_us > 0 && AsyncSignalScanner::nextPulseTimeoutTime_us < micros())
-        { // may be current pulse has now timedout so we have a signal?
-
-          AsyncSignalScanner::onPulseTimerTimeout(); // refresh signal properties
+        unsigned long fingerprint; // 0: free slot
+        unsigned long seen_ms;
+        DedupCache::PayloadRecord payload; // what the plugin recorded in the DedupCache for this frame
+      };
+
+      static DecodedFrame frames[REPEAT_FINGERPRINT_SLOTS];
+      static byte nextSlot = 0;
+
+      /**
+       * @return the frame decoded less than signal_repeat_time ago with this fingerprint, nullptr if none
+       * */
+      static DecodedFrame *find(unsigned long fingerprint)
+      {
+        const unsigned long now_ms = millis();
 
-          if (!RawSignal.readyForDecoder) // still dont have a valid signal?
-            return false;
+        for (byte i = 0; i < REPEAT_FINGERPRINT_SLOTS; i++)
+        {
+          DecodedFrame &frame = frames[i];
+          if (frame.fingerprint == fingerprint && (now_ms - frame.seen_ms) <= params::signal_repeat_time)
+            return &frame;
         }
-        else
-          return false;
+        return nullptr;
       }
 
-      counters::receivedSignalsCount++; // we have a signal, let's increment counters
-
-      byte signalWasDecoded = PluginRXCall(0, 0); // Check all plugins to see which plugin can handle the received signal.
-      if (signalWasDecoded)
-      { // Check all plugins to see which plugin can handle the received signal.
-        counters::successfullyDecodedSignalsCount++;
-        RepeatingTimer = millis() + params::signal_repeat_time;
+      static void remember(unsigned long fingerprint)
+      {
+        DecodedFrame &frame = frames[nextSlot];
+        frame.fingerprint = fingerprint;
+        frame.seen_ms = millis();
+        frame.payload = DedupCache::runtime::lastRecord;
+        nextSlot = (nextSlot + 1) % REPEAT_FINGERPRINT_SLOTS;
       }
-      AsyncSignalScanner::startScanning();
-      return (signalWasDecoded != 0);
     }
 
-    namespace AsyncSignalScanner
+    namespace RepeatVoting
     {
-      unsigned long int lastChangedState_us = 0;
-      unsigned long int nextPulseTimeoutTime_us = 0;
-      bool scanningStopped = true;
+      struct Segment
+      {
+        int start;  // index of its first pulse
+        int length; // including the gap that ends it, the last segment of a signal has none
+      };
+
+      // the signal kept before the plugins, then voted in place: stored like RawSignal.Pulses, so the plugins can read
+      // the voted frame through a PulseSpan
+#ifdef RFLINK_SIGNAL_COMPACT_PULSES
+      static CompactPulses<RAW_BUFFER_SIZE + 2> keptPulses;
+#else
+      static ShiftablePulses<RAW_BUFFER_SIZE + 2> keptPulses;
+#endif
+      static int keptNumber = 0;
+      static uint32_t keptGapThreshold;
 
-      void enableAsyncReceiver()
+      static inline bool similarPulses(uint16_t a, uint16_t b)
       {
-        params::async_mode_enabled = true;
-        startScanning();
+        // within 30% of each other
+        return (uint32_t)a * 10 <= (uint32_t)b * 13 && (uint32_t)b * 10 <= (uint32_t)a * 13;
       }
 
-      void disableAsyncReceiver()
+      /// same frame: same length, once the gap missing at the end of the signal is counted, starting on the same level
+      static inline bool sameFrame(const Segment &a, const Segment &b, int signalEnd)
       {
-        params::async_mode_enabled = false;
-        stopScanning();
+        const int aLength = a.length + (a.start + a.length > signalEnd ? 1 : 0);
+        const int bLength = b.length + (b.start + b.length > signalEnd ? 1 : 0);
+        return aLength == bLength && ((a.start ^ b.start) & 1) == 0;
       }
 
-      void startScanning()
+      bool keep(const PulseSpan &frame)
       {
-        if (params::async_mode_enabled)
-        {
-          scanningStopped = false;
-          RawSignal.readyForDecoder = false;
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
-          RawSignal.Multiply = params::sample_rate;
-          lastChangedState_us = 0;
-          nextPulseTimeoutTime_us = 0;
-          attachInterrupt(digitalPinToInterrupt(Radio::pins::RX_DATA), RX_pin_changed_state, CHANGE);
-        }
-        else
+        keptNumber = 0;
+        if (frame.Number < (int)(REPEAT_VOTING_MIN_REPEATS * params::min_raw_pulses))
+          return false;
+
+        uint32_t total = 0;
+        for (int i = 1; i <= frame.Number; i++)
+          total += frame.Pulses[i];
+        const uint32_t gapThreshold = total / frame.Number * REPEAT_VOTING_GAP_FACTOR;
+
+        // the repeats are separated by long gaps, the last one may end the frame without its gap
+        byte gapsCount = 0;
+        for (int i = 1; i < frame.Number && gapsCount < REPEAT_VOTING_MIN_REPEATS - 1; i++)
         {
-          Serial.println(F("Start of async Receiver was requested but it's not enabled!"));
+          if (frame.Pulses[i] >= gapThreshold)
+            gapsCount++;
         }
+        if (gapsCount < REPEAT_VOTING_MIN_REPEATS - 1)
+          return false;
+
+        memcpy((void *)&PULSES_STORAGE(keptPulses)[1], (const void *)&PULSES_VIEW_STORAGE(frame.Pulses)[1],
+               sizeof(PulseCode) * frame.Number);
+        keptNumber = frame.Number;
+        keptGapThreshold = gapThreshold;
+        return true;
       }
 
-      void stopScanning()
+      /**
+       * Votes the kept signal into keptPulses: the voted pulse of offset N is written to pulse N + 1, once the repeats
+       * have been read at offset N, and they all start at pulse 1 or later
+       * @return the number of voted pulses, 0 if the signal is not made of enough repeats
+       * */
+      static int vote()
       {
-        if(params::async_mode_enabled) {
-          scanningStopped = true;
-          detachInterrupt(Radio::pins::RX_DATA);
+        const int number = keptNumber;
+        const uint32_t gapThreshold = keptGapThreshold;
+        keptNumber = 0; // voted once
+        if (number == 0)
+          return 0;
+
+        Segment segments[REPEAT_VOTING_MAX_SEGMENTS];
+        byte segmentsCount = 0;
+        int start = 1;
+        for (int i = 1; i <= number && segmentsCount < REPEAT_VOTING_MAX_SEGMENTS; i++)
+        {
+          if (i < number && keptPulses[i] < gapThreshold)
+            continue;
+
+          if (i - start + 1 > (int)params::min_raw_pulses)
+            segments[segmentsCount++] = {start, i - start + 1};
+          start = i + 1;
         }
-      }
+        // a segment running past Number is the last one, without its gap
+        const int signalEnd = number + (keptPulses[number] < gapThreshold ? 0 : 1);
 
-      void IRAM_ATTR RX_pin_changed_state()
-      {
-        static unsigned long lastChangedState_us = 0;
-        unsigned long changeTime_us = micros();
+        // the repeats: most frequent length, with a complete one as reference
+        byte best = 0, bestCount = 0;
+        for (byte a = 0; a < segmentsCount; a++)
+        {
+          if (segments[a].start + segments[a].length > signalEnd)
+            continue;
+          byte count = 0;
+          for (byte b = 0; b < segmentsCount; b++)
+          {
+            if (sameFrame(segments[a], segments[b], signalEnd))
+              count++;
+          }
+          if (count > bestCount)
+          {
+            best = a;
+            bestCount = count;
+          }
+        }
+        if (bestCount < REPEAT_VOTING_MIN_REPEATS)
+          return 0;
 
-        if (RawSignal.readyForDecoder) // it means previous packet has not been decoded yet, let's forget about it
-          return;
+        const Segment reference = segments[best];
+        Segment repeats[REPEAT_VOTING_MAX_SEGMENTS];
+        byte repeatsCount = 0;
+        for (byte i = 0; i < segmentsCount; i++)
+        {
+          if (sameFrame(segments[i], reference, signalEnd))
+            repeats[repeatsCount++] = segments[i];
+        }
 
-        unsigned long pulseLength_us = changeTime_us - lastChangedState_us;
-        lastChangedState_us = changeTime_us;
+        for (int offset = 0; offset < reference.length; offset++)
+        {
+          uint16_t pulses[REPEAT_VOTING_MAX_SEGMENTS];
+          byte pulsesCount = 0;
+          for (byte r = 0; r < repeatsCount; r++)
+          {
+            if (offset < repeats[r].length)
+              pulses[pulsesCount++] = keptPulses[repeats[r].start + offset];
+          }
 
-        if (pulseLength_us < params::min_pulse_len)
-        {                              // this is too short, noise?
-          nextPulseTimeoutTime_us = 0; // stop watching for a timeout
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
+          // the value agreed on by the most repeats wins, averaged over them, none beats one all the repeats agree on
+          byte winnerVotes = 0;
+          uint32_t winnerTotal = 0;
+          for (byte candidate = 0; candidate < pulsesCount && winnerVotes < pulsesCount; candidate++)
+          {
+            byte votes = 0;
+            uint32_t votesTotal = 0;
+            for (byte r = 0; r < pulsesCount; r++)
+            {
+              if (similarPulses(pulses[r], pulses[candidate]))
+              {
+                votes++;
+                votesTotal += pulses[r];
+              }
+            }
+            if (votes > winnerVotes)
+            {
+              winnerVotes = votes;
+              winnerTotal = votesTotal;
+            }
+          }
+          keptPulses[offset + 1] = winnerTotal / winnerVotes;
         }
+        keptPulses[0] = 0;
+        keptPulses[reference.length + 1] = params::signal_end_timeout;
 
-        int pinState = digitalRead(Radio::pins::RX_DATA);
+        return reference.length;
+      }
 
-        if (RawSignal.Time == 0)
-        {                    // this is potentially the beginning of a new signal
-          if (pinState != 1) // if we get 0 here it means that we are in the middle of a signal, let's forget about it
-            return;
+      bool decodeVoted()
+      {
+        const int votedCount = vote();
+        if (votedCount == 0)
+          return false;
+        return PluginRXCall(PulseSpan(keptPulses, votedCount, RawSignal.Multiply, RawSignal.rssi, RawSignal.Time));
+      }
+    }
 
-          RawSignal.Time = millis(); // record when this signal started
-          RawSignal.Multiply = Signal::params::sample_rate;
-          nextPulseTimeoutTime_us = changeTime_us + SIGNAL_END_TIMEOUT_US;
+    namespace NoiseGate
+    {
+      static const byte bucketsCount = 64;
 
-          return;
-        }
+      /// quarter of octave of a pulse length, from 0 to bucketsCount - 1
+      static inline byte lengthBucket(uint16_t length)
+      {
+        if (length < 4)
+          return length;
+        const byte msb = 31 - __builtin_clz(length);
+        return msb * 4 + ((length >> (msb - 2)) & 3);
+      }
 
-        if (pulseLength_us > SIGNAL_END_TIMEOUT_US)
-        { // signal timedout but was not caught by main loop! We will do its job
-          onPulseTimerTimeout();
-          return;
+      static inline bool gate(GateReasons reason)
+      {
+        counters::gatedFrames[reason]++;
+        return true;
+      }
+
+      bool isNoise(const PulseSpan &frame)
+      {
+        // the gap ending the frame is the timeout which has ended it, not a pulse of the frame
+        const int last = min(frame.Number % 2 == 0 ? frame.Number - 1 : frame.Number, RAW_BUFFER_SIZE);
+        if (last < 1)
+          return false;
+
+        byte buckets[RAW_BUFFER_SIZE + 1]; // of every pulse, computed once
+        uint64_t occupied = 0;
+        for (int i = 1; i <= last; i++)
+        {
+          buckets[i] = lengthBucket(frame.Pulses[i]);
+          occupied |= 1ULL << buckets[i];
         }
 
-        RawSignal.Number++;
+        // a cluster is a run of occupied buckets, a long run is cut into several clusters
+        byte clusterOf[bucketsCount];
+        byte clustersCount = 0;
+        byte run = 0;
+        for (byte bucket = 0; bucket < bucketsCount; bucket++)
+        {
+          if (!((occupied >> bucket) & 1))
+          {
+            run = 0;
+            continue;
+          }
+          if (run % NOISE_GATE_CLUSTER_BUCKETS == 0)
+          {
+            if (++clustersCount > params::noise_gate_max_clusters)
+              return gate(GateReasons::TooManyClusters);
+          }
+          run++;
+          clusterOf[bucket] = clustersCount - 1;
+        }
 
-        if (RawSignal.Number >= RAW_BUFFER_SIZE)
-        {                              // this signal has too many pulses and will be discarded
-          nextPulseTimeoutTime_us = 0; // stop watching for a timeout
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
-          //Serial.println("this signal has too many pulses and will be discarded");
-          return;
+        // at most one cluster every other bucket
+        uint32_t totals[bucketsCount / 2];
+        uint64_t squaresTotals[bucketsCount / 2];
+        uint16_t counts[bucketsCount / 2];
+        memset(totals, 0, sizeof(uint32_t) * clustersCount);
+        memset(squaresTotals, 0, sizeof(uint64_t) * clustersCount);
+        memset(counts, 0, sizeof(uint16_t) * clustersCount);
+        for (int i = 1; i <= last; i++)
+        {
+          const uint32_t pulse = frame.Pulses[i];
+          const byte cluster = clusterOf[buckets[i]];
+          totals[cluster] += pulse;
+          squaresTotals[cluster] += pulse * pulse;
+          counts[cluster]++;
         }
 
-        if (RawSignal.Number == 0 && pulseLength_us < SIGNAL_MIN_PREAMBLE_US)
-        {                              // too short preamble, let's drop it
-          nextPulseTimeoutTime_us = 0; // stop watching for a timeout
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
-          //Serial.print("too short preamble, let's drop it:");Serial.println(pulseLength_us);
-          return;
+        // an outlier is the only pulse of its cluster
+        int outliers = 0;
+        uint32_t spreadTotal = 0; // squares of the distances of the pulses to the mean of their cluster, in percent
+        for (byte cluster = 0; cluster < clustersCount; cluster++)
+        {
+          if (counts[cluster] == 1)
+          {
+            outliers++;
+            continue;
+          }
+          // sum of (pulse - mean)^2 is sum of pulse^2 - total^2 / count
+          const uint64_t mean = totals[cluster] / counts[cluster];
+          if (mean != 0)
+            spreadTotal += (squaresTotals[cluster] - (uint64_t)totals[cluster] * totals[cluster] / counts[cluster]) * 10000 / (mean * mean);
         }
+        if ((unsigned long)outliers * 100 > params::noise_gate_max_outliers * last)
+          return gate(GateReasons::TooManyOutliers);
+        const int inliers = last - outliers;
+        if (inliers > 0 && spreadTotal / inliers > params::noise_gate_max_spread * params::noise_gate_max_spread)
+          return gate(GateReasons::WideClusters);
 
-        //Serial.print("found pulse #");Serial.println(RawSignal.Number);
-        RawSignal.Pulses[RawSignal.Number] = pulseLength_us / Signal::params::sample_rate;
-        nextPulseTimeoutTime_us = changeTime_us + SIGNAL_END_TIMEOUT_US;
+        return false;
       }
+    }
 
-      void onPulseTimerTimeout()
+    template <typename SignalType>
+    static bool decodeRealigned(SignalType &signal)
+    {
+      for (int first = 2; first <= REALIGN_MAX_SKIPPED_PULSES && signal.Number - first >= (int)params::min_raw_pulses; first += 2)
       {
-        if (RawSignal.readyForDecoder)
-        { // it means previous packet has not been decoded yet, let's forget about it
-          //Serial.println("previous signal not decoded yet, discarding this one");
-          nextPulseTimeoutTime_us = 0;
-          return;
-        }
+        PulsesWindow<SignalType> window(signal, first);
+        if (PluginRXCall(PulseSpan(signal)))
+          return true;
+      }
+      return false;
+    }
 
-        /*if (digitalRead(RX_DATA) == HIGH) {   // We have a corrupted packet here
-        Serial.println("corrupted signal ends with HIGH");
-        RawSignal.Number = 0;
-        RawSignal.Time = 0;
-        nextPulseTimeoutTime_us = 0;
-        return;
-      }*/
+    bool decodeRealigned()
+    {
+      return decodeRealigned(RawSignal);
+    }
 
-        if (RawSignal.Number == 0)
-        { // timeout on preamble!
-          //Serial.println("timeout on preamble");
-          nextPulseTimeoutTime_us = 0;
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
-          return;
-        }
+    /**
+     * Gives a signal (RawSignal, or a queued frame read in its slot) to the plugins, unless it is a repeat of a frame
+     * they decoded in the last signal_repeat_time.
+     * If none of them handles it, its repeats are voted into a clean frame which is given to them instead.
+     * @return true if a plugin has handled the signal
+     * */
+    template <typename SignalType>
+    static bool decodeSignal(SignalType &signal)
+    {
+      const PulseSpan frame(signal);
+      unsigned long fingerprint = 0;
 
-        if (RawSignal.Number < MIN_RAW_PULSES)
-        { // not enough pulses, we ignore it
-          nextPulseTimeoutTime_us = 0;
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
-          return;
+#ifndef RFLINK_CAPTURE_STREAM_DISABLED
+      CaptureStream::capture(frame, signal.endReason); // as received, before the plugins modify the pulses
+#endif // !RFLINK_CAPTURE_STREAM_DISABLED
+
+      counters::endedSignals[signal.endReason]++;
+      counters::acceptedPulseCounts[pulseCountBucket(signal.Number)]++;
+      if (runtime::appliedSlicer > Slicer_enum::Default && runtime::appliedSlicer < Slicer_enum::SLICERS_EOF)
+        counters::slicers[runtime::appliedSlicer].accepted++;
+
+      if (params::noise_gate_enabled && NoiseGate::isNoise(frame))
+        return false;
+
+      if (params::repeat_fingerprint_enabled)
+      {
+        fingerprint = computeFingerprint(frame); // before the plugins, some of them modify the pulses
+
+        RepeatFingerprints::DecodedFrame *frame = RepeatFingerprints::find(fingerprint);
+        if (frame != nullptr && fingerprint != 0)
+        {
+          // the burst goes on: keep every repeat filter as if the plugin had seen this frame
+          frame->seen_ms = millis();
+          DedupCache::refresh(frame->payload);
+          RepeatingTimer = millis() + params::signal_repeat_time;
+          counters::skippedRepeatsCount++;
+          return false;
         }
+        DedupCache::runtime::lastRecord.pluginNumber = 0;
+      }
 
-        // finally we have one!
-        stopScanning();
-        nextPulseTimeoutTime_us = 0;
-        RawSignal.Number++;
-        RawSignal.Pulses[RawSignal.Number] = SIGNAL_END_TIMEOUT_US / Signal::params::sample_rate;
-        //Serial.print("found one packet, marking now for decoding. Pulses = ");Serial.println(RawSignal.Number);
-        RawSignal.readyForDecoder = true;
+      // kept before the plugins as well, only voted if none of them decodes it
+      const bool votable = params::repeat_voting_enabled && RepeatVoting::keep(frame);
+
+      if (!PluginRXCall(frame))
+      {
+        if (params::realign_enabled && decodeRealigned(signal)) // before the vote, which may overwrite the frame
+          counters::realignedFramesCount++;
+        else if (votable && RepeatVoting::decodeVoted())
+          counters::votedFramesCount++;
+        else
+          return false;
       }
-    };
 
-    /*********************************************************************************************\
-   Send bitstream to RF - Plugin 004 (Newkaku) special version
-\*********************************************************************************************/
-    void AC_Send(unsigned long data, byte cmd)
-    {
-#define AC_FPULSE 260 // Pulse width in microseconds
-#define AC_FRETRANS 5 // Number of code retransmissions
+      counters::successfullyDecodedSignalsCount++;
+      RepeatingTimer = millis() + params::signal_repeat_time;
 
-      // Serial.println("Send AC");
-      // Serial.println(data, HEX);
-      // Serial.println(cmd, HEX);
+      // plugins which swallow a first frame (waiting for a confirmation) must still see the next one
+      if (fingerprint != 0 && pbuffer[0] != 0)
+        RepeatFingerprints::remember(fingerprint);
 
-      unsigned long bitstream = 0L;
-      byte command = 0;
-      // prepare data to send
-      for (unsigned short i = 0; i < 32; i++)
+      return true;
+    }
+
+    /**
+     * Hill climbing on the slicer parameters, one of them at a time: a window with the current values tells which
+     * way to move first (from its drops), then windows with the value moved by one step (trial) alternate with windows
+     * with the previous one (baseline) for at least AUTOTUNE_ROUNDS rounds. The move wins if the trial windows decode
+     * significantly more, see trialWins(). It is compared again from new baseline windows, and only kept (and saved
+     * to flash) once it has won AUTOTUNE_WINS comparisons in a row; otherwise the value is restored and the next
+     * parameter gets its turn.
+     * */
+    namespace AutoTune
+    {
+      struct TunedParameter
+      {
+        const char *json_name;
+        unsigned long int *value;
+        unsigned long int min;
+        unsigned long int max;
+        unsigned long int step;
+        signed char direction;       // next move, +1 or -1
+        unsigned long int accepted;  // moves which have been kept
+        unsigned long int rejected;
+      };
+
+      static TunedParameter tuned[] = {
+          {json_name_min_pulse_len, &params::min_pulse_len, 50, 250, 10, -1, 0, 0},
+          {json_name_min_preamble, &params::min_preamble, 50, 1000, 50, +1, 0, 0},
+          {json_name_signal_end_timeout, &params::signal_end_timeout, 2000, 10000, 500, -1, 0, 0},
+          {json_name_seek_timeout, &params::seek_timeout, 10, 100, 5, +1, 0, 0},
+      };
+      static const byte tunedCount = sizeof(tuned) / sizeof(tuned[0]);
+
+      enum Phases
+      {
+        Idle,
+        Baseline, // measuring the current values
+        Trial,    // measuring tuned[current] moved by one step
+      };
+      static const char *const phaseNames[] = {"idle", "baseline", "trial"};
+
+      struct WindowCounters
+      {
+        unsigned long int received;
+        unsigned long int decoded;
+        unsigned long int dropped[DropReasons::DROP_REASONS_EOF];
+        unsigned long int ended[EndReasons::REASONS_EOF];
+      };
+
+      static Phases phase = Idle;
+      static byte current = 0;
+      static bool comparing = false;      // a new value of tuned[current] is being compared with the previous one
+      static byte windowIndex = 0;        // windows measured in the comparison, the first one with the previous value
+      static byte wins = 0;               // comparisons won in a row by the new value
+      static unsigned long int previousValue;
+      static unsigned long int newValue;
+      static unsigned long windowStart_ms;
+      static WindowCounters windowStart;
+      static unsigned long int baselineDecoded, trialDecoded; // over the windows of the comparison
+      static unsigned long baselineTime_ms, trialTime_ms;
+      static float baselineRate = 0; // decodes per hour
+      static float trialRate = 0;
+
+      static void readCounters(WindowCounters &window)
+      {
+        window.received = counters::receivedSignalsCount;
+        window.decoded = counters::successfullyDecodedSignalsCount;
+        for (byte i = 0; i < DropReasons::DROP_REASONS_EOF; i++)
+          window.dropped[i] = counters::droppedSignals[i];
+        for (byte i = 0; i < EndReasons::REASONS_EOF; i++)
+          window.ended[i] = counters::endedSignals[i];
+      }
+
+      static void startWindow(Phases newPhase)
+      {
+        phase = newPhase;
+        windowStart_ms = millis();
+        readCounters(windowStart);
+      }
+
+      /**
+       * The drop and end reason counters were zeroed, the window being measured starts again
+       * */
+      static void restartWindow()
+      {
+        if (phase != Idle)
+          startWindow(phase);
+      }
+
+      static void applyValue(TunedParameter &parameter, unsigned long int value)
+      {
+        Config::ConfigItem *item = Config::findConfigItem(parameter.json_name, Config::SectionId::Signal_id);
+        item->setUnsignedLongIntValue(value);
+        refreshParametersFromConfig();
+      }
+
+      /**
+       * Moves the parameter the way the drops of the last window point to, if they point anywhere
+       * */
+      static void chooseDirection(TunedParameter &parameter, const WindowCounters &window)
+      {
+        if (parameter.value == &params::min_pulse_len && window.dropped[DropReasons::ShortPulse] > window.decoded)
+          parameter.direction = -1; // broken signals outnumber the decoded ones
+        else if (parameter.value == &params::min_preamble && window.dropped[DropReasons::TooFewPulses] > window.received)
+          parameter.direction = +1; // noise starts most signals
+        else if (parameter.value == &params::signal_end_timeout &&
+                 (window.ended[EndReasons::TooLong] > 0 || window.dropped[DropReasons::TooManyPulses] > 0))
+          parameter.direction = -1; // signals run into each other
+      }
+
+      /**
+       * Windows with the previous value (baseline) and with the new one (trial) come as ABBA ABBA...,
+       * so that a change of the traffic during the comparison weighs the same on both
+       * */
+      static inline Phases windowPhase(byte index)
+      {
+        return ((index + 1) / 2) % 2 == 0 ? Baseline : Trial;
+      }
+
+      static void startComparison()
+      {
+        comparing = true;
+        windowIndex = 0;
+        baselineDecoded = trialDecoded = 0;
+        baselineTime_ms = trialTime_ms = 0;
+        applyValue(tuned[current], previousValue);
+        startWindow(Baseline);
+      }
+
+      /**
+       * Picks the value one step away from the current one, the first baseline window is the one just measured
+       * @return false if the parameter cannot move either way
+       * */
+      static bool startTrial(const WindowCounters &window)
+      {
+        TunedParameter &parameter = tuned[current];
+        chooseDirection(parameter, window);
+
+        for (byte attempt = 0; attempt < 2; attempt++)
+        {
+          const unsigned long int value = *parameter.value;
+          unsigned long int candidate;
+          if (parameter.direction > 0)
+            candidate = value + parameter.step > parameter.max ? parameter.max : value + parameter.step;
+          else
+            candidate = value < parameter.min + parameter.step ? parameter.min : value - parameter.step;
+
+          if (candidate != value)
+          {
+            previousValue = value;
+            newValue = candidate;
+            comparing = true;
+            windowIndex = 1;
+            applyValue(parameter, newValue);
+            startWindow(Trial);
+            return true;
+          }
+          parameter.direction = -parameter.direction; // at a bound
+        }
+        return false;
+      }
+
+      static void nextParameter()
+      {
+        current = (current + 1) % tunedCount;
+        comparing = false;
+        wins = 0;
+        startWindow(Baseline);
+      }
+
+      /**
+       * Given n decodes over both kinds of windows, the trial windows get n * trialTime / totalTime of them on average
+       * if both values decode as well. The new value wins if it decodes AUTOTUNE_MIN_GAIN_PERCENT more per hour,
+       * and its decodes are AUTOTUNE_MIN_Z standard deviations above that average (binomial test).
+       * */
+      static bool trialWins()
+      {
+        const float decoded = baselineDecoded + trialDecoded;
+        const float trialShare = (float)trialTime_ms / (baselineTime_ms + trialTime_ms);
+        const float expected = decoded * trialShare;
+        const float deviation = sqrtf(decoded * trialShare * (1 - trialShare));
+
+        return trialRate * 100 >= baselineRate * (100 + AUTOTUNE_MIN_GAIN_PERCENT) &&
+               trialDecoded > expected + AUTOTUNE_MIN_Z * deviation;
+      }
+
+      static void endComparison()
+      {
+        TunedParameter &parameter = tuned[current];
+
+        if (baselineDecoded + trialDecoded < AUTOTUNE_MIN_DECODES)
+        { // too quiet to tell
+          parameter.rejected++;
+          applyValue(parameter, previousValue);
+          nextParameter();
+          return;
+        }
+
+        if (!trialWins())
+        {
+          parameter.rejected++;
+          applyValue(parameter, previousValue);
+          parameter.direction = -parameter.direction;
+          nextParameter();
+          return;
+        }
+
+        if (++wins < AUTOTUNE_WINS)
+        { // compared again, from new baseline windows
+          startComparison();
+          return;
+        }
+
+        wins = 0;
+        parameter.accepted++;
+        applyValue(parameter, newValue);
+        Serial.printf_P(PSTR("Autotune: keeping %s=%lu (%.0f decodes/h instead of %.0f)\r\n"), parameter.json_name, newValue, trialRate, baselineRate);
+        Config::saveConfigToFlash();
+        // same way while it improves, from a baseline window with the value just kept
+        comparing = false;
+        startWindow(Baseline);
+      }
+
+      static void loop()
+      {
+        if (!params::autotune_enabled)
+        {
+          if (phase == Trial)
+            applyValue(tuned[current], previousValue);
+          phase = Idle;
+          comparing = false;
+          wins = 0;
+          return;
+        }
+
+        if (phase == Idle)
+        {
+          startWindow(Baseline);
+          return;
+        }
+
+        const unsigned long elapsed_ms = millis() - windowStart_ms;
+        if (elapsed_ms < params::autotune_window * 1000UL)
+          return;
+
+        WindowCounters window;
+        readCounters(window);
+        window.received -= windowStart.received;
+        window.decoded -= windowStart.decoded;
+        for (byte i = 0; i < DropReasons::DROP_REASONS_EOF; i++)
+          window.dropped[i] -= windowStart.dropped[i];
+        for (byte i = 0; i < EndReasons::REASONS_EOF; i++)
+          window.ended[i] -= windowStart.ended[i];
+
+        if (!comparing)
+        { // the first baseline window of a comparison, which says which way to move
+          baselineDecoded = window.decoded;
+          baselineTime_ms = elapsed_ms;
+          trialDecoded = trialTime_ms = 0;
+        }
+        else if (phase == Baseline)
+        {
+          baselineDecoded += window.decoded;
+          baselineTime_ms += elapsed_ms;
+        }
+        else
+        {
+          trialDecoded += window.decoded;
+          trialTime_ms += elapsed_ms;
+        }
+        baselineRate = baselineTime_ms == 0 ? 0 : (float)baselineDecoded * 3600000.0F / baselineTime_ms;
+        trialRate = trialTime_ms == 0 ? 0 : (float)trialDecoded * 3600000.0F / trialTime_ms;
+
+        if (!comparing)
+        {
+          if (!startTrial(window))
+            nextParameter();
+          return;
+        }
+
+        windowIndex++;
+        const bool roundsDone = windowIndex >= 2 * AUTOTUNE_ROUNDS;
+        if (roundsDone && (baselineDecoded + trialDecoded >= AUTOTUNE_MIN_DECODES || windowIndex >= 2 * AUTOTUNE_MAX_ROUNDS))
+        {
+          endComparison();
+          return;
+        }
+
+        const Phases next = windowPhase(windowIndex);
+        if (next != phase)
+          applyValue(tuned[current], next == Baseline ? previousValue : newValue);
+        startWindow(next);
+      }
+
+      static void printState()
+      {
+        sprintf_P(printBuf, PSTR("30;signal;autotune;enabled=%s;phase=%s;parameter=%s;windows=%u;wins=%u;baseline_rate=%.0f;trial_rate=%.0f;window_s=%lu;"),
+                  params::autotune_enabled ? "true" : "false", phaseNames[phase], tuned[current].json_name,
+                  comparing ? windowIndex : 0, wins, baselineRate, trialRate, params::autotune_window);
+        sendRawPrint(printBuf, true);
+        for (byte i = 0; i < tunedCount; i++)
+        {
+          sprintf_P(printBuf, PSTR("30;signal;autotune;%s=%lu;min=%lu;max=%lu;step=%lu;direction=%i;accepted=%lu;rejected=%lu;"),
+                    tuned[i].json_name, *tuned[i].value, tuned[i].min, tuned[i].max, tuned[i].step,
+                    (int)tuned[i].direction, tuned[i].accepted, tuned[i].rejected);
+          sendRawPrint(printBuf, true);
+        }
+      }
+    }
+
+    void resetDropStats()
+    {
+      for (byte i = 0; i < DropReasons::DROP_REASONS_EOF; i++)
+        counters::droppedSignals[i] = 0;
+      memset(counters::endedSignals, 0, sizeof(counters::endedSignals));
+      memset(counters::gatedFrames, 0, sizeof(counters::gatedFrames));
+      for (byte i = 0; i < PULSE_COUNT_BUCKETS; i++)
+        counters::droppedPulseCounts[i] = 0;
+      memset(counters::acceptedPulseCounts, 0, sizeof(counters::acceptedPulseCounts));
+      for (byte i = 0; i < Slicer_enum::SLICERS_EOF; i++)
+      {
+        counters::slicers[i].accepted = 0;
+        for (byte j = 0; j < DropReasons::DROP_REASONS_EOF; j++)
+          counters::slicers[i].dropped[j] = 0;
+      }
+      AutoTune::restartWindow();
+    }
+
+    boolean ScanEvent()
+    {
+      if (Radio::current_State != Radio::States::Radio_RX)
+        return false;
+
+      AutoTune::loop();
+
+      if (!params::async_mode_enabled)
+      {
+
+        unsigned long Timer = millis() + params::scan_high_time;
+
+        while (Timer > millis()) // || RepeatingTimer > millis())
+        {
+          if (fetchSignal())
+          { // RF: *** data start ***
+            counters::receivedSignalsCount++;
+            if (decodeSignal(RawSignal))
+            { // Check all plugins to see which plugin can handle the received signal.
+              //auto responseLength = strlen(pbuffer);
+              //if(responseLength>1)
+              //  sprintf(&pbuffer[responseLength-2], "RSSI=%i;\r\n", (int)RawSignal.rssi);
+              return true;
+            }
+          }
+        } // while
+        return false;
+      }
+
+      // here we are in ASYNC mode
+
+      #ifdef RFLINK_ASYNC_DECODE_TASK
+      if (AsyncSignalScanner::isDecodeTaskRunning())
+      { // frames are ended by a timer and decoded by the decode task, only their messages are left to send
+        if (runtime::appliedSlicer == Slicer_enum::RSSI_Advanced)
+          AsyncSignalScanner::checkLongPulseRssi();
+        return AsyncSignalScanner::takeDecodedMessage();
+      }
+      #endif
+
+      if (params::async_edge_capture_enabled)
+        AsyncSignalScanner::processCapturedEdges();
+      else if (AsyncSignalScanner::nextPulseTimeoutTime_us > 0 && AsyncSignalScanner::nextPulseTimeoutTime_us < micros())
+      { // may be current pulse has now timedout so we have a signal?
+        ASYNC_QUEUE_LOCK(); // the interrupt may be writing into the same slot
+        if (AsyncSignalScanner::nextPulseTimeoutTime_us > 0 && AsyncSignalScanner::nextPulseTimeoutTime_us < micros())
+          AsyncSignalScanner::onPulseTimerTimeout(); // refresh signal properties
+        ASYNC_QUEUE_UNLOCK();
+      }
+
+      if (runtime::appliedSlicer == Slicer_enum::RSSI_Advanced)
+        AsyncSignalScanner::checkLongPulseRssi();
+
+      AsyncSignalScanner::CapturedFrame *frame = AsyncSignalScanner::peekCapturedFrame();
+      if (frame == nullptr) // still dont have a valid signal?
+        return false;
+
+      counters::receivedSignalsCount++; // we have a signal, let's increment counters
+      RawSignal.readyForDecoder = true;
+
+      bool signalWasDecoded = decodeSignal(*frame); // Check all plugins to see which plugin can handle the received signal.
+      AsyncSignalScanner::releaseCapturedFrame();
+      RawSignal.readyForDecoder = false;
+      return signalWasDecoded;
+    }
+
+    namespace AsyncSignalScanner
+    {
+      unsigned long int lastChangedState_us = 0;
+      volatile unsigned long int nextPulseTimeoutTime_us = 0;
+      bool scanningStopped = true;
+
+      CapturedFrame frameQueue[ASYNC_FRAME_QUEUE_SLOTS];
+      volatile byte queueHead = 0; // slot being filled by the interrupt, only moved by the interrupt
+      volatile byte queueTail = 0; // oldest frame waiting for the decoder, only moved by ScanEvent()
+      volatile int lastChangedLevel = 0; // level of the pin after the last edge
+
+      /**
+       * RSSI_Advanced slicer statistics on the gaps of the frame being captured
+       * */
+      struct SlicerState
+      {
+        unsigned long gapsTotalLength;
+        unsigned long averagedGapsLength;
+        unsigned long dynamicGapEnd_us; // a gap longer than this ends the signal
+      };
+
+      static SlicerState slicerState;
+
+      /**
+       * checkLongPulseRssi() state, main loop only
+       * */
+      struct LongPulseRssiWatch
+      {
+        unsigned long pulseStart_us; // pulse being watched, 0 if none
+        float referenceRssi;
+      };
+
+      static LongPulseRssiWatch longPulseRssiWatch = {0, 0.0F};
+
+      /**
+       * Edge capture mode: the interrupt appends to edgeBuffers[edgeFillIndex] while processCapturedEdges() empties the other one
+       * */
+      struct EdgeBuffer
+      {
+        volatile unsigned short int count;
+        volatile bool overflowed;
+        uint32_t edges[ASYNC_EDGE_BUFFER_SIZE]; // bit 31: pin level after the edge, bits 0..30: microseconds since the previous edge
+      };
+
+      EdgeBuffer edgeBuffers[2];
+      volatile byte edgeFillIndex = 0;
+      volatile unsigned long int lastEdge_us = 0; // when the last recorded edge occured
+
+      #define EDGE_LEVEL_BIT 0x80000000UL
+      #define EDGE_DELTA_MASK 0x7FFFFFFFUL
+
+      #ifdef ESP8266
+      #define RX_PIN_LEVEL() GPIP(Radio::pins::RX_DATA) // direct register read, digitalRead() is not inlined
+      #else
+      #define RX_PIN_LEVEL() digitalRead(Radio::pins::RX_DATA)
+      #endif
+
+      #ifdef RFLINK_SIGNAL_ISR_STATS
+      #define ISR_STATS_BEGIN() const uint32_t isrStart_cycles = ESP.getCycleCount()
+      #define ISR_STATS_END() countIsrCycles(ESP.getCycleCount() - isrStart_cycles)
+
+      static inline void IRAM_ATTR countIsrCycles(uint32_t cycles)
+      {
+        counters::asyncIsrCalls++;
+        counters::asyncIsrCyclesTotal += cycles;
+        if (cycles < counters::asyncIsrCyclesMin)
+          counters::asyncIsrCyclesMin = cycles;
+        if (cycles > counters::asyncIsrCyclesMax)
+          counters::asyncIsrCyclesMax = cycles;
+      }
+      #else
+      #define ISR_STATS_BEGIN()
+      #define ISR_STATS_END()
+      #endif
+
+      #ifdef RFLINK_ASYNC_DECODE_TASK
+      static TaskHandle_t decodeTaskHandle = nullptr;
+      static SemaphoreHandle_t decoderMutex = nullptr;
+      static esp_timer_handle_t endOfFrameTimer = nullptr;
+      static volatile bool endOfFrameTimerArmed = false;
+
+      // messages decoded by the task, waiting for the main loop to send them
+      static char decodedMessages[ASYNC_DECODED_MESSAGES_SLOTS][PRINT_BUFFER_SIZE];
+      static byte decodedMessagesHead = 0;
+      static byte decodedMessagesCount = 0;
+
+      static void startDecodeTask();
+
+      /**
+       * One shot: only the first edge after the timer went off arms it again, the decode task re-arms it
+       * for what is left of the timeout of the frame being captured.
+       * */
+      static inline void IRAM_ATTR armEndOfFrameTimer(unsigned long timeout_us)
+      {
+        if (!endOfFrameTimerArmed && endOfFrameTimer != nullptr)
+        {
+          endOfFrameTimerArmed = true;
+          esp_timer_start_once(endOfFrameTimer, timeout_us);
+        }
+      }
+      #else
+      static inline void IRAM_ATTR armEndOfFrameTimer(unsigned long timeout_us) {}
+      #endif
+
+      void enableAsyncReceiver()
+      {
+        params::async_mode_enabled = true;
+        startScanning();
+      }
+
+      void disableAsyncReceiver()
+      {
+        params::async_mode_enabled = false;
+        stopScanning();
+      }
+
+      void startScanning()
+      {
+        if (params::async_mode_enabled)
+        {
+          scanningStopped = false;
+          // frames already waiting in the queue are kept, only the partial one is forgotten
+          frameQueue[queueHead].Number = 0;
+          frameQueue[queueHead].Time = 0;
+          lastChangedState_us = 0;
+          nextPulseTimeoutTime_us = 0;
+          #ifdef RFLINK_ASYNC_DECODE_TASK
+          startDecodeTask();
+          #endif
+          if (params::async_edge_capture_enabled)
+          {
+            edgeBuffers[0].count = 0;
+            edgeBuffers[0].overflowed = false;
+            edgeBuffers[1].count = 0;
+            edgeBuffers[1].overflowed = false;
+            attachInterrupt(digitalPinToInterrupt(Radio::pins::RX_DATA), RX_pin_edge_recorded, CHANGE);
+          }
+          else
+            attachInterrupt(digitalPinToInterrupt(Radio::pins::RX_DATA), RX_pin_changed_state, CHANGE);
+        }
+        else
+        {
+          Serial.println(F("Start of async Receiver was requested but it's not enabled!"));
+        }
+      }
+
+      void stopScanning()
+      {
+        if(params::async_mode_enabled) {
+          scanningStopped = true;
+          detachInterrupt(Radio::pins::RX_DATA);
+        }
+      }
+
+      /**
+       * Queues the frame being captured for the decoder, or drops it if it is too short
+       * @param lastPulse_us length of a final gap which has not been stored yet, 0 if there is none
+       * */
+      static void IRAM_ATTR finishFrame(EndReasons reason, unsigned long lastPulse_us)
+      {
+        CapturedFrame &frame = frameQueue[queueHead];
+        nextPulseTimeoutTime_us = 0;
+
+        if (frame.Number < (int)params::min_raw_pulses)
+        { // timeout on preamble or not enough pulses, we ignore it
+          countDrop(DropReasons::TooFewPulses, frame.Number);
+          frame.Number = 0;
+          frame.Time = 0;
+          return;
+        }
+
+        byte nextHead = (queueHead + 1) % ASYNC_FRAME_QUEUE_SLOTS;
+
+        if (nextHead == queueTail)
+        { // every other slot is still waiting for the decoder, this frame is lost
+          counters::asyncFrameQueueOverruns++;
+          frame.Number = 0;
+          frame.Time = 0;
+          return;
+        }
+
+        // finally we have one!
+        if (lastPulse_us > 0)
+        {
+          frame.Number++;
+          frame.Pulses[frame.Number] = lastPulse_us / Signal::params::sample_rate;
+        }
+        frame.endReason = reason;
+        frame.lastEdge_us = lastChangedState_us;
+        //Serial.print("found one packet, queuing it for decoding. Pulses = ");Serial.println(frame.Number);
+        queueHead = nextHead;
+
+        unsigned short int pending = (queueHead + ASYNC_FRAME_QUEUE_SLOTS - queueTail) % ASYNC_FRAME_QUEUE_SLOTS;
+        if (pending > counters::asyncFrameQueueHighWaterMark)
+          counters::asyncFrameQueueHighWaterMark = pending;
+
+        frameQueue[queueHead].Number = 0;
+        frameQueue[queueHead].Time = 0;
+      }
+
+      static inline void IRAM_ATTR startFrame(CapturedFrame &frame, unsigned long changeTime_us)
+      {
+        frame.Number = 0;
+        frame.Time = millis(); // record when this signal started
+        frame.Multiply = Signal::params::sample_rate;
+        frame.rssi = -9999.0F;
+        frame.endReason = EndReasons::Unknown;
+        slicerState.gapsTotalLength = 0;
+        slicerState.averagedGapsLength = 0;
+        slicerState.dynamicGapEnd_us = 0;
+        nextPulseTimeoutTime_us = changeTime_us + params::signal_end_timeout;
+      }
+
+      /**
+       * Legacy slicer: fixed end of signal timeout, any too short pulse drops the signal
+       * @param pinState level of the pin after the edge
+       * */
+      static inline void IRAM_ATTR processEdgeLegacy(unsigned long changeTime_us, unsigned long pulseLength_us, int pinState)
+      {
+        if (frameQueue[queueHead].Time != 0 && pulseLength_us > params::signal_end_timeout)
+        { // signal timedout but was not caught by main loop! We will do its job and this edge may start the next one
+          onPulseTimerTimeout();
+        }
+
+        CapturedFrame &frame = frameQueue[queueHead];
+
+        if (pulseLength_us < params::min_pulse_len)
+        {                              // this is too short, noise?
+          if (frame.Time != 0)
+            countDrop(DropReasons::ShortPulse, frame.Number);
+          nextPulseTimeoutTime_us = 0; // stop watching for a timeout
+          frame.Number = 0;
+          frame.Time = 0;
+        }
+
+        if (frame.Time == 0)
+        {                    // this is potentially the beginning of a new signal
+          if (pinState != 1) // if we get 0 here it means that we are in the middle of a signal, let's forget about it
+            return;
+
+          startFrame(frame, changeTime_us);
+          return;
+        }
+
+        frame.Number++;
+
+        if (frame.Number >= RAW_BUFFER_SIZE)
+        {                              // this signal has too many pulses and will be discarded
+          countDrop(DropReasons::TooManyPulses, frame.Number);
+          nextPulseTimeoutTime_us = 0; // stop watching for a timeout
+          frame.Number = 0;
+          frame.Time = 0;
+          //Serial.println("this signal has too many pulses and will be discarded");
+          return;
+        }
+
+        //Serial.print("found pulse #");Serial.println(frame.Number);
+        frame.Pulses[frame.Number] = pulseLength_us / Signal::params::sample_rate;
+        nextPulseTimeoutTime_us = changeTime_us + params::signal_end_timeout;
+      }
+
+      /**
+       * Interrupt side of the RSSI_Advanced slicer, see FetchSignal_sync_rssi().
+       * The RSSI cannot be read from an interrupt, checkLongPulseRssi() does the long pulse part from the main loop.
+       * @param pinState level of the pin after the edge
+       * */
+      static inline void IRAM_ATTR processEdgeRssi(unsigned long changeTime_us, unsigned long pulseLength_us, int pinState)
+      {
+        const bool endedPulseIsGap = (pinState == 1);
+
+        if (frameQueue[queueHead].Time != 0)
+        {
+          if (pulseLength_us > params::signal_end_timeout)
+          { // signal timedout but was not caught by main loop! We will do its job and this edge may start the next one
+            onPulseTimerTimeout();
+          }
+          else if (endedPulseIsGap && slicerState.dynamicGapEnd_us > 200 && pulseLength_us > slicerState.dynamicGapEnd_us)
+          { // gap much longer than the average ones, the signal is over
+            frameQueue[queueHead].Number++;
+            frameQueue[queueHead].Pulses[frameQueue[queueHead].Number] = pulseLength_us / Signal::params::sample_rate;
+            lastChangedState_us = changeTime_us; // the frame ends with this edge
+            finishFrame(EndReasons::DynamicGapLengthReached, 0);
+          }
+        }
+
+        CapturedFrame &frame = frameQueue[queueHead];
+
+        if (frame.Time == 0)
+        { // the gap before a new signal is its preamble
+          if (pinState != 1 || pulseLength_us < params::min_preamble)
+            return;
+
+          startFrame(frame, changeTime_us);
+          return;
+        }
+
+        if (pulseLength_us < params::min_pulse_len)
+        {
+          // noise right after a gap 1.5x longer than the average ones probably hides the end of the signal, let's try to decode it
+          if (!endedPulseIsGap && slicerState.dynamicGapEnd_us > 0 && frame.Number > 0 &&
+              (unsigned long)frame.Pulses[frame.Number] * params::sample_rate >= slicerState.averagedGapsLength * 150 / 100)
+          {
+            finishFrame(EndReasons::AttemptedNoiseFilter, 0);
+            return;
+          }
+
+          countDrop(DropReasons::ShortPulse, frame.Number);
+          nextPulseTimeoutTime_us = 0; // it seems to be noise so we're out !
+          frame.Number = 0;
+          frame.Time = 0;
+          return;
+        }
+
+        if (frame.Number + 1 >= RAW_BUFFER_SIZE)
+        { // the decoder gets what we have
+          finishFrame(EndReasons::TooLong, 0);
+          return;
+        }
+
+        if (endedPulseIsGap)
+        {
+          if (frame.Number > 15)
+          {
+            slicerState.averagedGapsLength = slicerState.gapsTotalLength / (frame.Number / 2);
+            slicerState.dynamicGapEnd_us = slicerState.averagedGapsLength * 3;
+          }
+          slicerState.gapsTotalLength += pulseLength_us / params::sample_rate;
+        }
+
+        frame.Number++;
+        frame.Pulses[frame.Number] = pulseLength_us / Signal::params::sample_rate;
+
+        if (!endedPulseIsGap && slicerState.dynamicGapEnd_us > 200 && slicerState.dynamicGapEnd_us < params::signal_end_timeout)
+          nextPulseTimeoutTime_us = changeTime_us + slicerState.dynamicGapEnd_us; // a gap starts, it may end the signal earlier
+        else
+          nextPulseTimeoutTime_us = changeTime_us + params::signal_end_timeout;
+      }
+
+      /**
+       * Adds one edge to the frame being captured in frameQueue[queueHead]
+       * @param pinState level of the pin after the edge
+       * */
+      static inline void IRAM_ATTR processEdge(unsigned long changeTime_us, int pinState)
+      {
+        unsigned long pulseLength_us = changeTime_us - lastChangedState_us;
+
+        if (runtime::appliedSlicer == Slicer_enum::RSSI_Advanced)
+          processEdgeRssi(changeTime_us, pulseLength_us, pinState);
+        else
+          processEdgeLegacy(changeTime_us, pulseLength_us, pinState);
+
+        lastChangedState_us = changeTime_us;
+        lastChangedLevel = pinState;
+      }
+
+      void IRAM_ATTR RX_pin_changed_state()
+      {
+        ISR_STATS_BEGIN();
+        processEdge(micros(), digitalRead(Radio::pins::RX_DATA));
+        armEndOfFrameTimer(params::signal_end_timeout);
+        ISR_STATS_END();
+      }
+
+      void checkLongPulseRssi()
+      {
+        lockDecoder(); // frames may be built by the decode task
+        ASYNC_QUEUE_LOCK();
+        const bool inPulse = frameQueue[queueHead].Time != 0 && lastChangedLevel == 1;
+        const unsigned long pulseStart_us = lastChangedState_us;
+        const int number = frameQueue[queueHead].Number;
+        ASYNC_QUEUE_UNLOCK();
+        unlockDecoder();
+
+        if (!inPulse)
+        {
+          longPulseRssiWatch.pulseStart_us = 0;
+          return;
+        }
+
+        float newRssi = Radio::getCurrentRssi(); // slow, outside of the critical section
+
+        if (longPulseRssiWatch.pulseStart_us != pulseStart_us)
+        { // first look at this pulse
+          longPulseRssiWatch.pulseStart_us = pulseStart_us;
+          longPulseRssiWatch.referenceRssi = newRssi;
+        }
+        else
+        {
+          // like FetchSignal_sync_rssi(): the signal has not really started yet, or the pulse has lasted for a while
+          const unsigned long pulseLength_us = micros() - pulseStart_us;
+          const bool rssiGap = number == 0 ? (pulseLength_us > 150 && isRssiGap(longPulseRssiWatch.referenceRssi, newRssi, runtime::rssiGapEarly_dB))
+                                           : (pulseLength_us > LONG_PULSE_RSSI_CHECK_US && isRssiGap(longPulseRssiWatch.referenceRssi, newRssi, runtime::rssiGapLongPulse_dB));
+          if (rssiGap)
+          {
+            bool restarted = false;
+
+            lockDecoder();
+            ASYNC_QUEUE_LOCK();
+            // nothing happened since we looked (edges waiting in the edge buffer count too), restart the signal from scratch at this pulse
+            CapturedFrame &frame = frameQueue[queueHead];
+            if (lastChangedState_us == pulseStart_us && frame.Time != 0 &&
+                (!params::async_edge_capture_enabled || edgeBuffers[edgeFillIndex].count == 0))
+            {
+              frame.Number = 0;
+              frame.rssi = newRssi;
+              slicerState.gapsTotalLength = 0;
+              slicerState.averagedGapsLength = 0;
+              slicerState.dynamicGapEnd_us = 0;
+              lastChangedState_us = micros();
+              nextPulseTimeoutTime_us = lastChangedState_us + params::signal_end_timeout;
+              restarted = true;
+            }
+            longPulseRssiWatch.pulseStart_us = lastChangedState_us;
+            ASYNC_QUEUE_UNLOCK();
+            unlockDecoder();
+
+            if (restarted && runtime::verboseSignalFetchLoop)
+            {
+              LineWriter line;
+              line.print(F("LONG Pulse resets async signal because of RSSI gap within it (refRssi=")).print(longPulseRssiWatch.referenceRssi, 0);
+              line.print(F(" newRssi=")).print(newRssi, 0).print(F(" length=")).print(pulseLength_us).print(F(" pos=")).print(number).print(')');
+              line.println();
+            }
+            longPulseRssiWatch.referenceRssi = newRssi;
+            return;
+          }
+
+          if (longPulseRssiWatch.referenceRssi < newRssi)
+            longPulseRssiWatch.referenceRssi = newRssi;
+        }
+
+        lockDecoder();
+        ASYNC_QUEUE_LOCK();
+        if (lastChangedState_us == pulseStart_us && frameQueue[queueHead].rssi < newRssi)
+          frameQueue[queueHead].rssi = newRssi;
+        ASYNC_QUEUE_UNLOCK();
+        unlockDecoder();
+      }
+
+      void IRAM_ATTR RX_pin_edge_recorded()
+      {
+        ISR_STATS_BEGIN();
+        unsigned long changeTime_us = micros();
+        uint32_t level = RX_PIN_LEVEL() ? EDGE_LEVEL_BIT : 0;
+        unsigned long delta_us = changeTime_us - lastEdge_us;
+        lastEdge_us = changeTime_us;
+
+        EdgeBuffer &buffer = edgeBuffers[edgeFillIndex];
+        if (buffer.count < ASYNC_EDGE_BUFFER_SIZE)
+        {
+          if (delta_us > EDGE_DELTA_MASK)
+            delta_us = EDGE_DELTA_MASK;
+          buffer.edges[buffer.count] = delta_us | level;
+          buffer.count = buffer.count + 1;
+        }
+        else
+          buffer.overflowed = true;
+        armEndOfFrameTimer(params::signal_end_timeout);
+        ISR_STATS_END();
+      }
+
+      void processCapturedEdges()
+      {
+        // swap the buffers, the interrupt carries on in the empty one
+        ASYNC_QUEUE_LOCK();
+        EdgeBuffer &buffer = edgeBuffers[edgeFillIndex];
+        edgeFillIndex ^= 1;
+        unsigned long bufferEnd_us = lastEdge_us;
+        ASYNC_QUEUE_UNLOCK();
+
+        const unsigned short int count = buffer.count;
+
+        // only deltas are recorded, go back from the time of the last edge to get the time of each one
+        unsigned long changeTime_us = bufferEnd_us;
+        for (unsigned short int i = 0; i < count; i++)
+          changeTime_us -= buffer.edges[i] & EDGE_DELTA_MASK;
+
+        for (unsigned short int i = 0; i < count; i++)
+        {
+          const uint32_t edge = buffer.edges[i];
+          changeTime_us += edge & EDGE_DELTA_MASK;
+          processEdge(changeTime_us, (edge & EDGE_LEVEL_BIT) ? 1 : 0);
+        }
+
+        if (buffer.overflowed)
+        { // edges have been lost, the frame being captured is broken
+          counters::asyncEdgeBufferOverruns++;
+          nextPulseTimeoutTime_us = 0;
+          frameQueue[queueHead].Number = 0;
+          frameQueue[queueHead].Time = 0;
+          buffer.overflowed = false;
+        }
+        buffer.count = 0;
+
+        // an edge recorded since the swap would extend the current pulse, the timeout waits for the next call
+        if (nextPulseTimeoutTime_us > 0 && nextPulseTimeoutTime_us < micros() && edgeBuffers[edgeFillIndex].count == 0)
+          onPulseTimerTimeout();
+      }
+
+      /**
+       * Must not be interrupted by RX_pin_changed_state(), callers outside of the interrupt have to disable interrupts.
+       * */
+      void IRAM_ATTR onPulseTimerTimeout()
+      {
+        const unsigned long dynamicGapEnd_us = slicerState.dynamicGapEnd_us;
+
+        if (runtime::appliedSlicer == Slicer_enum::RSSI_Advanced && lastChangedLevel == 0 &&
+            dynamicGapEnd_us > 200 && dynamicGapEnd_us < params::signal_end_timeout)
+          finishFrame(EndReasons::DynamicGapLengthReached, dynamicGapEnd_us);
+        else
+          finishFrame(EndReasons::SignalEndTimeout, params::signal_end_timeout);
+      }
+
+      #ifdef RFLINK_ASYNC_DECODE_TASK
+      void lockDecoder()
+      {
+        if (decoderMutex != nullptr)
+          xSemaphoreTakeRecursive(decoderMutex, portMAX_DELAY);
+      }
+
+      void unlockDecoder()
+      {
+        if (decoderMutex != nullptr)
+          xSemaphoreGiveRecursive(decoderMutex);
+      }
+
+      /**
+       * Runs in the esp_timer task, which may not be on the core of the RX interrupt: frames are left to the decode task.
+       * */
+      static void onEndOfFrameTimer(void *)
+      {
+        endOfFrameTimerArmed = false;
+        xTaskNotifyGive(decodeTaskHandle);
+      }
+
+      static void decodeTask(void *)
+      {
+        for (;;)
+        {
+          ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ASYNC_DECODE_TASK_POLL_MS));
+
+          if (!params::async_mode_enabled || scanningStopped)
+            continue;
+
+          lockDecoder();
+
+          if (params::async_edge_capture_enabled)
+            processCapturedEdges();
+          else
+          {
+            ASYNC_QUEUE_LOCK(); // this task runs on the core of the interrupt
+            if (nextPulseTimeoutTime_us > 0 && nextPulseTimeoutTime_us < micros())
+              onPulseTimerTimeout();
+            ASYNC_QUEUE_UNLOCK();
+          }
+
+          ASYNC_QUEUE_LOCK();
+          if (nextPulseTimeoutTime_us > 0)
+          { // a frame is still being captured
+            long remaining_us = (long)(nextPulseTimeoutTime_us - micros());
+            armEndOfFrameTimer(remaining_us > 0 ? remaining_us : 1);
+          }
+          ASYNC_QUEUE_UNLOCK();
+
+          // pbuffer may hold a message from the main loop, plugins would overwrite it
+          CapturedFrame *frame;
+          while (pbuffer[0] == 0 && decodedMessagesCount < ASYNC_DECODED_MESSAGES_SLOTS && (frame = peekCapturedFrame()) != nullptr)
+          {
+            counters::receivedSignalsCount++;
+            RawSignal.readyForDecoder = true;
+            if (decodeSignal(*frame) && pbuffer[0] != 0)
+            {
+              memcpy(decodedMessages[(decodedMessagesHead + decodedMessagesCount) % ASYNC_DECODED_MESSAGES_SLOTS], pbuffer, PRINT_BUFFER_SIZE);
+              decodedMessagesCount++;
+              pbuffer[0] = 0;
+            }
+            releaseCapturedFrame();
+            RawSignal.readyForDecoder = false;
+          }
+
+          unlockDecoder();
+        }
+      }
+
+      static void startDecodeTask()
+      {
+        if (decodeTaskHandle != nullptr)
+          return;
+
+        if (decoderMutex == nullptr)
+          decoderMutex = xSemaphoreCreateRecursiveMutex();
+
+        // pinned to the core of the interrupt (the one running setup()), so ASYNC_QUEUE_LOCK() keeps them apart
+        if (xTaskCreatePinnedToCore(decodeTask, "rflink_decode", ASYNC_DECODE_TASK_STACK_SIZE, nullptr,
+                                    ASYNC_DECODE_TASK_PRIORITY, &decodeTaskHandle, xPortGetCoreID()) != pdPASS)
+        {
+          decodeTaskHandle = nullptr;
+          Serial.println(F("Failed to start the async decode task, frames will be decoded by the main loop"));
+          return;
+        }
+
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = onEndOfFrameTimer;
+        timerArgs.name = "rflink_end_of_frame";
+        if (esp_timer_create(&timerArgs, &endOfFrameTimer) != ESP_OK)
+        {
+          endOfFrameTimer = nullptr;
+          Serial.println(F("Failed to create the end of frame timer, the decode task will poll"));
+        }
+      }
+
+      bool takeDecodedMessage()
+      {
+        bool taken = false;
+
+        lockDecoder();
+        if (decodedMessagesCount > 0 && pbuffer[0] == 0)
+        {
+          memcpy(pbuffer, decodedMessages[decodedMessagesHead], PRINT_BUFFER_SIZE);
+          decodedMessagesHead = (decodedMessagesHead + 1) % ASYNC_DECODED_MESSAGES_SLOTS;
+          decodedMessagesCount--;
+          taken = true;
+        }
+        unlockDecoder();
+
+        if (taken) // there is room for one more message
+          xTaskNotifyGive(decodeTaskHandle);
+        return taken;
+      }
+
+      bool isDecodeTaskRunning()
+      {
+        return decodeTaskHandle != nullptr;
+      }
+      #endif // RFLINK_ASYNC_DECODE_TASK
+
+      static void recordDecodeLatency(unsigned long latency_us)
+      {
+        byte bucket = 0;
+        for (unsigned long limit_us = 1000; bucket < ASYNC_LATENCY_BUCKETS - 1 && latency_us >= limit_us; limit_us <<= 1)
+          bucket++;
+
+        counters::asyncDecodeLatency[bucket]++;
+        if (latency_us > counters::asyncDecodeLatencyMax_us)
+          counters::asyncDecodeLatencyMax_us = latency_us;
+      }
+
+      CapturedFrame *peekCapturedFrame()
+      {
+        const byte tail = queueTail;
+
+        if (tail == queueHead)
+          return nullptr;
+
+        CapturedFrame &frame = frameQueue[tail];
+        frame.Pulses[0] = 0; // the marker of the plugins, like on a new RawSignal
+        recordDecodeLatency(micros() - frame.lastEdge_us);
+        return &frame;
+      }
+
+      void releaseCapturedFrame()
+      {
+        queueTail = (queueTail + 1) % ASYNC_FRAME_QUEUE_SLOTS; // slot can now be reused by the interrupt
+      }
+
+      unsigned short int pendingFramesCount()
+      {
+        return (queueHead + ASYNC_FRAME_QUEUE_SLOTS - queueTail) % ASYNC_FRAME_QUEUE_SLOTS;
+      }
+
+      void resetIsrStats()
+      {
+        #ifdef RFLINK_SIGNAL_ISR_STATS
+        ASYNC_QUEUE_LOCK();
+        counters::asyncIsrCalls = 0;
+        counters::asyncIsrCyclesMin = UINT32_MAX;
+        counters::asyncIsrCyclesMax = 0;
+        counters::asyncIsrCyclesTotal = 0;
+        ASYNC_QUEUE_UNLOCK();
+        #endif
+        counters::asyncEdgeBufferOverruns = 0;
+      }
+
+      void resetLatencyStats()
+      {
+        memset(counters::asyncDecodeLatency, 0, sizeof(counters::asyncDecodeLatency));
+        counters::asyncDecodeLatencyMax_us = 0;
+      }
+    };
+
+    /*********************************************************************************************\
+   Send bitstream to RF - Plugin 004 (Newkaku) special version
+\*********************************************************************************************/
+    void AC_Send(unsigned long data, byte cmd)
+    {
+#define AC_FPULSE 260 // Pulse width in microseconds
+#define AC_FRETRANS 5 // Number of code retransmissions
+
+      // Serial.println("Send AC");
+      // Serial.println(data, HEX);
+      // Serial.println(cmd, HEX);
+
+      unsigned long bitstream = 0L;
+      byte command = 0;
+      // prepare data to send
+      for (unsigned short i = 0; i < 32; i++)
       { // reverse data bits
         bitstream <<= 1;
         bitstream |= (data & B1);
@@ -1067,7 +2573,8 @@ namespace RFLink
           return;
         }
 
-        while(RawSignal.Number >= (int)params::min_raw_pulses) {
+        for (int first = 0; RawSignal.Number - first >= (int)params::min_raw_pulses; first += 2) {
+          PulsesWindow<RawSignalStruct> window(RawSignal, first); // the frame seen from its pulse first + 1, nothing is moved
 
           Serial.printf_P(PSTR("Sending your signal to Plugins (%i pulses)\r\n"), RawSignal.Number);
           displaySignal(RawSignal);
@@ -1081,8 +2588,6 @@ namespace RFLink
             break;
           }
 
-          RawSignal.Number -= 2;
-          memcpy((void *)&RawSignal.Pulses[1], (void *)&RawSignal.Pulses[3], sizeof(uint16_t)*RawSignal.Number);
           yield();
         }
 
@@ -1097,6 +2602,90 @@ namespace RFLink
         sendRawPrint(PSTR("30;verboseSignalFetchLoop"));
         sendRawPrint(PSTR(" disabled;"),true);
       }
+      else if (strncasecmp_P(cmd, commands::isrStats, commandSize) == 0) {
+        #ifdef RFLINK_SIGNAL_ISR_STATS
+        ASYNC_QUEUE_LOCK();
+        unsigned long calls = counters::asyncIsrCalls;
+        uint32_t min_cycles = calls > 0 ? counters::asyncIsrCyclesMin : 0;
+        uint32_t max_cycles = counters::asyncIsrCyclesMax;
+        uint64_t total_cycles = counters::asyncIsrCyclesTotal;
+        ASYNC_QUEUE_UNLOCK();
+        sprintf_P(printBuf, PSTR("30;signal;isr;mode=%s;calls=%lu;min_cycles=%lu;avg_cycles=%lu;max_cycles=%lu;edge_buffer_overruns=%lu;"),
+                  params::async_edge_capture_enabled ? "edges" : "frames", calls, (unsigned long)min_cycles,
+                  (unsigned long)(calls > 0 ? total_cycles / calls : 0), (unsigned long)max_cycles, counters::asyncEdgeBufferOverruns);
+        sendRawPrint(printBuf, true);
+        #else
+        sendRawPrint(F("30;signal;isr;disabled;"), true);
+        #endif
+      }
+      else if (strncasecmp_P(cmd, commands::resetIsrStats, commandSize) == 0) {
+        AsyncSignalScanner::resetIsrStats();
+        sendRawPrint(F("30;signal;isr;reset;"), true);
+      }
+      else if (strncasecmp_P(cmd, commands::latencyStats, commandSize) == 0) {
+        static const char *const bucketLabels[ASYNC_LATENCY_BUCKETS] = {"<1ms", "<2ms", "<4ms", "<8ms", "<16ms", "<32ms", "<64ms", "<128ms", "<256ms", ">=256ms"};
+        sendRawPrint(F("30;signal;latency;"));
+        for (byte i = 0; i < ASYNC_LATENCY_BUCKETS; i++)
+        {
+          sprintf_P(printBuf, PSTR("%s=%lu;"), bucketLabels[i], counters::asyncDecodeLatency[i]);
+          sendRawPrint(printBuf);
+        }
+        sprintf_P(printBuf, PSTR("max_us=%lu;"), counters::asyncDecodeLatencyMax_us);
+        sendRawPrint(printBuf, true);
+      }
+      else if (strncasecmp_P(cmd, commands::resetLatencyStats, commandSize) == 0) {
+        AsyncSignalScanner::resetLatencyStats();
+        sendRawPrint(F("30;signal;latency;reset;"), true);
+      }
+      else if (strncasecmp_P(cmd, commands::dropStats, commandSize) == 0) {
+        sendRawPrint(F("30;signal;drops;"));
+        for (byte i = 0; i < DropReasons::DROP_REASONS_EOF; i++)
+        {
+          sprintf_P(printBuf, PSTR("%s=%lu;"), dropReasonToString((DropReasons)i), counters::droppedSignals[i]);
+          sendRawPrint(printBuf);
+        }
+        sendRawPrint(F("ended;"));
+        for (byte i = 0; i < EndReasons::REASONS_EOF; i++)
+        {
+          sprintf_P(printBuf, PSTR("%s=%lu;"), endReasonToString((EndReasons)i), counters::endedSignals[i]);
+          sendRawPrint(printBuf, i == EndReasons::REASONS_EOF - 1);
+        }
+        sendRawPrint(F("30;signal;gated;"));
+        for (byte i = 0; i < GateReasons::GATE_REASONS_EOF; i++)
+        {
+          sprintf_P(printBuf, PSTR("%s=%lu;"), gateReasonToString((GateReasons)i), counters::gatedFrames[i]);
+          sendRawPrint(printBuf, i == GateReasons::GATE_REASONS_EOF - 1);
+        }
+        sendRawPrint(F("30;signal;pulses;accepted;"));
+        for (byte i = 0; i < PULSE_COUNT_BUCKETS; i++)
+        {
+          sprintf_P(printBuf, PSTR("<%lu=%lu;"), 2UL << i, counters::acceptedPulseCounts[i]);
+          sendRawPrint(printBuf);
+        }
+        sendRawPrint(F("dropped;"));
+        for (byte i = 0; i < PULSE_COUNT_BUCKETS; i++)
+        {
+          sprintf_P(printBuf, PSTR("<%lu=%lu;"), 2UL << i, counters::droppedPulseCounts[i]);
+          sendRawPrint(printBuf, i == PULSE_COUNT_BUCKETS - 1);
+        }
+        for (byte i = 0; i < Slicer_enum::SLICERS_EOF; i++)
+        {
+          sprintf_P(printBuf, PSTR("30;signal;slicer;%s;accepted=%lu;"), slicerIdToString((Slicer_enum)i), counters::slicers[i].accepted);
+          sendRawPrint(printBuf);
+          for (byte j = 0; j < DropReasons::DROP_REASONS_EOF; j++)
+          {
+            sprintf_P(printBuf, PSTR("%s=%lu;"), dropReasonToString((DropReasons)j), counters::slicers[i].dropped[j]);
+            sendRawPrint(printBuf, j == DropReasons::DROP_REASONS_EOF - 1);
+          }
+        }
+      }
+      else if (strncasecmp_P(cmd, commands::resetDropStats, commandSize) == 0) {
+        resetDropStats();
+        sendRawPrint(F("30;signal;drops;reset;"), true);
+      }
+      else if (strncasecmp_P(cmd, commands::autotune, commandSize) == 0) {
+        AutoTune::printState();
+      }
       else
       {
         Serial.printf_P(PSTR("Error : unknown command '%s'\r\n"), cmd);
@@ -1110,33 +2699,75 @@ namespace RFLink
       auto &&signal = output.createNestedObject("signal");
       signal[F("received_signal_count")] = counters::receivedSignalsCount;
       signal[F("successfully_decoded_count")] = counters::successfullyDecodedSignalsCount;
+      signal[F("skipped_repeats_count")] = counters::skippedRepeatsCount;
+      signal[F("voted_frames_count")] = counters::votedFramesCount;
+      signal[F("realigned_frames_count")] = counters::realignedFramesCount;
+      auto &&dropped = signal.createNestedObject(F("dropped_signals"));
+      for (byte i = 0; i < DropReasons::DROP_REASONS_EOF; i++)
+        dropped[dropReasonToString((DropReasons)i)] = counters::droppedSignals[i];
+      auto &&ended = signal.createNestedObject(F("ended_signals"));
+      for (byte i = 0; i < EndReasons::REASONS_EOF; i++)
+        ended[endReasonToString((EndReasons)i)] = counters::endedSignals[i];
+      auto &&gated = signal.createNestedObject(F("gated_frames"));
+      for (byte i = 0; i < GateReasons::GATE_REASONS_EOF; i++)
+        gated[gateReasonToString((GateReasons)i)] = counters::gatedFrames[i];
+      auto &&acceptedPulses = signal.createNestedArray(F("accepted_pulse_counts"));
+      for (byte i = 0; i < PULSE_COUNT_BUCKETS; i++)
+        acceptedPulses.add(counters::acceptedPulseCounts[i]);
+      auto &&droppedPulses = signal.createNestedArray(F("dropped_pulse_counts"));
+      for (byte i = 0; i < PULSE_COUNT_BUCKETS; i++)
+        droppedPulses.add(counters::droppedPulseCounts[i]);
+      auto &&slicers = signal.createNestedObject(F("slicers"));
+      for (byte i = 0; i < Slicer_enum::SLICERS_EOF; i++)
+      {
+        auto &&slicer = slicers.createNestedObject(slicerIdToString((Slicer_enum)i));
+        slicer[F("accepted")] = counters::slicers[i].accepted;
+        for (byte j = 0; j < DropReasons::DROP_REASONS_EOF; j++)
+          slicer[dropReasonToString((DropReasons)j)] = counters::slicers[i].dropped[j];
+      }
+      if (params::async_mode_enabled)
+      {
+        signal[F("async_queue_slots")] = ASYNC_FRAME_QUEUE_SLOTS;
+        signal[F("async_queue_pending")] = AsyncSignalScanner::pendingFramesCount();
+        signal[F("async_queue_high_water_mark")] = counters::asyncFrameQueueHighWaterMark;
+        signal[F("async_queue_overruns")] = counters::asyncFrameQueueOverruns;
+        signal[F("async_edge_capture")] = params::async_edge_capture_enabled;
+        signal[F("async_edge_buffer_overruns")] = counters::asyncEdgeBufferOverruns;
+        #ifdef RFLINK_ASYNC_DECODE_TASK
+        signal[F("async_decode_task")] = AsyncSignalScanner::isDecodeTaskRunning();
+        #endif
+        auto &&latency = signal.createNestedArray(F("async_decode_latency"));
+        for (byte i = 0; i < ASYNC_LATENCY_BUCKETS; i++)
+          latency.add(counters::asyncDecodeLatency[i]);
+        signal[F("async_decode_latency_max_us")] = counters::asyncDecodeLatencyMax_us;
+        #ifdef RFLINK_SIGNAL_ISR_STATS
+        unsigned long calls = counters::asyncIsrCalls;
+        signal[F("async_isr_calls")] = calls;
+        signal[F("async_isr_cycles_min")] = calls > 0 ? counters::asyncIsrCyclesMin : 0;
+        signal[F("async_isr_cycles_avg")] = calls > 0 ? (unsigned long)(counters::asyncIsrCyclesTotal / calls) : 0;
+        signal[F("async_isr_cycles_max")] = counters::asyncIsrCyclesMax;
+        #endif
+      }
     }
 
     void displaySignal(RawSignalStruct &signal) {
-      RFLink::sendRawPrint(F("20;XX;DEBUG;Pulses=")); // debug data
-      RFLink::sendRawPrint(signal.Number);         // print number of pulses
-      RFLink::sendRawPrint(F(";Pulses(uSec)="));      // print pulse durations
+      LineWriter line;
+      line.print(F("20;XX;DEBUG;Pulses=")).print(signal.Number); // debug data, number of pulses
+      line.print(F(";Pulses(uSec)="));                           // pulse durations
       // ----------------------------------
-      char dbuffer[10];
-
       for (int i = 1; i < signal.Number + 1; i++)
       {
         if (QRFDebug == true)
-        {
-          sprintf(dbuffer, "%02x", signal.Pulses[i]);
-          RFLink::sendRawPrint(dbuffer);
-        }
+          line.printHex((uint16_t)signal.Pulses[i], 2, false);
         else
         {
-          RFLink::sendRawPrint(signal.Pulses[i] * signal.Multiply);
+          line.print(signal.Pulses[i] * signal.Multiply);
           if (i < signal.Number)
-            RFLink::sendRawPrint(',');
+            line.print(',');
         }
       }
-      RFLink::sendRawPrint(F(";RSSI="));
-      sprintf_P(dbuffer, PSTR("%i;"), (int)signal.rssi);
-      RFLink::sendRawPrint(dbuffer);
-      RFLink::sendRawPrint(F("\r\n"));
+      line.print(F(";RSSI=")).print((int)signal.rssi).print(';');
+      line.println();
     }
 
     const char * const EndReasonsStrings[] PROGMEM = {
@@ -1154,6 +2785,31 @@ namespace RFLink
       return EndReasonsStrings[(int) reason];
     }
 
+    const char * const DropReasonsStrings[] PROGMEM = {
+      "ShortPulse",
+      "TooFewPulses",
+      "TooManyPulses",
+      "SeekTimeout",
+      "DROP_REASONS_EOF"
+    };
+    static_assert(sizeof(DropReasonsStrings)/sizeof(char *) == DropReasons::DROP_REASONS_EOF+1, "DropReasonsStrings has missing/extra names, please compare with DropReasons enum declarations");
+
+    const char * dropReasonToString(DropReasons reason) {
+      return DropReasonsStrings[(int) reason];
+    }
+
+    const char * const GateReasonsStrings[] PROGMEM = {
+      "TooManyClusters",
+      "TooManyOutliers",
+      "WideClusters",
+      "GATE_REASONS_EOF"
+    };
+    static_assert(sizeof(GateReasonsStrings)/sizeof(char *) == GateReasons::GATE_REASONS_EOF+1, "GateReasonsStrings has missing/extra names, please compare with GateReasons enum declarations");
+
+    const char * gateReasonToString(GateReasons reason) {
+      return GateReasonsStrings[(int) reason];
+    }
+
     const char * const SlicerNamesStrings[] PROGMEM = {
             "Legacy",
             "RSSI_advanced"
@@ -1164,6 +2820,12 @@ namespace RFLink
       return  SlicerNamesStrings[(int) slicer];
     }
 
+    void setPulseSource(PulseSource *source) {
+      if(source == nullptr)
+        source = &gpioPulseSource;
+      runtime::pulseSource = source;
+    }
+
     bool updateSlicer(Slicer_enum newSlicer) {
 
       runtime::appliedSlicer = Slicer_enum::Legacy;
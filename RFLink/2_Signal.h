@@ -10,8 +10,9 @@
 
 #include <Arduino.h>
 #include "11_Config.h"
+#include "16_PulseStorage.h"
 
-#ifdef ESP32
+#if defined(ESP32) || defined(RFLINK_NATIVE_BUILD)
 #define RAW_BUFFER_SIZE 1200        // 292        // Maximum number of pulses that is received in one go.
 #else
 #define RAW_BUFFER_SIZE 292        // 292        // Maximum number of pulses that is received in one go.
@@ -24,6 +25,70 @@
 #define SIGNAL_REPEAT_TIME_MS 250  // 500        // Time in mSec. in which the same RF signal should not be accepted again. Filters out retransmits.
 #define SCAN_HIGH_TIME_MS 50       // 50         // time interval in ms. fast processing for background tasks
 
+#ifndef ASYNC_FRAME_QUEUE_SLOTS
+#ifdef ESP32
+#define ASYNC_FRAME_QUEUE_SLOTS 4  // Number of frame slots shared by the async receiver and the decoder (one is always being filled, one is held while decoded)
+#else
+#define ASYNC_FRAME_QUEUE_SLOTS 3
+#endif
+#endif
+
+#ifndef ASYNC_EDGE_BUFFER_SIZE
+#ifdef ESP32
+#define ASYNC_EDGE_BUFFER_SIZE 512 // Number of edges the interrupt can record before the main loop collects them (edge capture mode, two buffers)
+#else
+#define ASYNC_EDGE_BUFFER_SIZE 256
+#endif
+#endif
+
+#if defined(ESP32) && !defined(RFLINK_ASYNC_DECODE_TASK_DISABLED)
+#define RFLINK_ASYNC_DECODE_TASK // async frames are ended by a timer and decoded by their own task instead of the main loop
+#endif
+
+#ifndef ASYNC_DECODED_MESSAGES_SLOTS
+#define ASYNC_DECODED_MESSAGES_SLOTS 4 // Number of messages the decode task can keep while the main loop is busy
+#endif
+#define ASYNC_DECODE_TASK_STACK_SIZE 8192
+#define ASYNC_DECODE_TASK_PRIORITY 2 // above the Arduino loop task
+#define ASYNC_DECODE_TASK_POLL_MS 20 // the decode task also wakes up by itself, in case a notification was missed
+
+#define ASYNC_LATENCY_BUCKETS 10 // last edge to decode start histogram: <1ms, <2ms, <4ms ... <256ms, more
+#define PULSE_COUNT_BUCKETS 11   // pulses per frame histogram: <2, <4, <8 ... <2048
+
+#define LONG_PULSE_RSSI_CHECK_US 3000 // RSSI_Advanced slicers: how long a pulse must last before a rising RSSI restarts the signal
+#define RSSI_GAP_EARLY_DB 6            // RSSI_Advanced slicers: rise of the RSSI within a long pulse which restarts a signal that has barely started
+#define RSSI_GAP_LONG_PULSE_DB 3       // same, within a pulse which has lasted LONG_PULSE_RSSI_CHECK_US
+#define RSSI_SAMPLE_INTERVAL_US 80     // RSSI_Advanced sync slicer: the RSSI is read at most this often, the data output is polled in between
+
+#if !defined(RFLINK_SIGNAL_ISR_STATS_DISABLED) && (defined(ESP32) || defined(ESP8266))
+#define RFLINK_SIGNAL_ISR_STATS // CPU cycles spent in the async receiver interrupt
+#endif
+
+#ifndef REPEAT_FINGERPRINT_SLOTS
+#define REPEAT_FINGERPRINT_SLOTS 4 // Number of recently decoded frames whose repeats are dropped before reaching the plugins
+#endif
+
+#define REPEAT_VOTING_MIN_REPEATS 3     // Segments of equal length needed for a vote across the repeats of a frame
+#define REPEAT_VOTING_MAX_SEGMENTS 16   // A frame is split into this many segments at most
+#define REPEAT_VOTING_GAP_FACTOR 4      // A pulse this many times longer than the average one separates two repeats
+
+#define REALIGN_MAX_SKIPPED_PULSES 8    // Frames no plugin decodes are tried again without up to this many first pulses
+
+#define NOISE_GATE_MAX_CLUSTERS 8       // Default number of distinct pulse lengths above which a frame is noise
+#define NOISE_GATE_MAX_SPREAD 20        // Default RMS distance, in %, of the pulses to the mean of their cluster above which a frame is noise
+#define NOISE_GATE_MAX_OUTLIERS 25      // Default share, in %, of pulses whose length is found nowhere else in the frame above which it is noise
+#define NOISE_GATE_CLUSTER_BUCKETS 2    // A cluster spans at most this many quarters of octave of pulse lengths
+
+#define SIGNAL_DROP_MIN_PULSES 8        // Dropped signals with less pulses than this are noise, they are not counted
+
+#define AUTOTUNE_WINDOW_S 600           // Default time during which the decodes of one setting are counted
+#define AUTOTUNE_ROUNDS 3               // A comparison alternates at least this many windows of each setting
+#define AUTOTUNE_MAX_ROUNDS 9           // Rounds are added, up to this many, until the comparison has AUTOTUNE_MIN_DECODES
+#define AUTOTUNE_MIN_DECODES 200        // Decodes over all the windows of a comparison below which nothing is decided
+#define AUTOTUNE_MIN_GAIN_PERCENT 10    // A new setting wins if it decodes this much more than the previous one
+#define AUTOTUNE_MIN_Z 2.6F             // and its decodes are this many standard deviations above chance (0.5% false wins)
+#define AUTOTUNE_WINS 2                 // Comparisons in a row a new setting must win before it is kept and saved
+
 #define DEFAULT_RAWSIGNAL_SAMPLE_RATE 1    // for compatibility with Arduinos only unless you want to scan pulses > 65000us
 
 #if defined(RFLINK_SIGNAL_DEBUG)
@@ -49,6 +114,23 @@ namespace RFLink {
       REASONS_EOF,
     };
 
+    /// Why the slicers threw away a signal they had started to capture
+    enum DropReasons {
+      ShortPulse,     // a pulse shorter than min_pulse_len
+      TooFewPulses,   // ended before min_raw_pulses
+      TooManyPulses,  // legacy async slicer: more than RAW_BUFFER_SIZE pulses
+      SeekTimeout,    // RSSI_Advanced sync slicer: seek_timeout reached while pulses were being stored
+      DROP_REASONS_EOF,
+    };
+
+    /// Why the noise gate threw away a frame before the plugins
+    enum GateReasons {
+      TooManyClusters, // more than noise_gate_max_clusters distinct pulse lengths
+      TooManyOutliers, // more than noise_gate_max_outliers % of the pulses have a length found nowhere else in the frame
+      WideClusters,    // the pulses are spread more than noise_gate_max_spread % around the mean of their cluster
+      GATE_REASONS_EOF,
+    };
+
     enum Slicer_enum {
       Default = -1,
       Legacy,
@@ -67,18 +149,63 @@ namespace RFLink {
       float rssi;
       EndReasons endReason;
       #ifdef RFLINK_SIGNAL_RSSI_DEBUG
-      float Rssis[RAW_BUFFER_SIZE + 1];
+      #ifdef RFLINK_SIGNAL_COMPACT_PULSES
+      CompactRssis<RAW_BUFFER_SIZE + 1> Rssis;
+      #else
+      ShiftableRssis<RAW_BUFFER_SIZE + 1> Rssis; // RSSI of each pulse, shifted with Pulses
+      #endif
+      #endif
+      #ifdef RFLINK_SIGNAL_COMPACT_PULSES
+      CompactPulses<RAW_BUFFER_SIZE + 1> Pulses; // Same as below, one byte per pulse, see 16_PulseStorage.h
+      #else
+      ShiftablePulses<RAW_BUFFER_SIZE + 1> Pulses; // Table with the measured pulses in microseconds divided by RawSignal.Multiply. (to keep compatibility with Arduino)
       #endif
-      uint16_t Pulses[RAW_BUFFER_SIZE + 1]; // Table with the measured pulses in microseconds divided by RawSignal.Multiply. (to keep compatibility with Arduino)
       // First pulse is located in element 1. Element 0 is used for special purposes, like signalling the use of a specific plugin
     };
 
     extern RawSignalStruct RawSignal;
 
+#ifdef RFLINK_SIGNAL_RSSI_DEBUG
+    /// the RSSI of each pulse stays beside it, see PulsesWindow
+    inline void shiftAlongPulses(RawSignalStruct &signal) { signal.Rssis.shift = signal.Pulses.shift; }
+#endif
+
+    struct FrameFeatures;
+
+    /**
+     * Read only view on a frame to decode, wherever its pulses are stored: RawSignal, a queued frame, a voted one...
+     * Indexed like RawSignal.Pulses: Pulses[1] is the first pulse, Pulses[0] a marker for the plugins.
+     * */
+    struct PulseSpan
+    {
+      PulsesView Pulses;
+      int Number;
+      byte Multiply;
+      float rssi;
+      unsigned long Time;
+
+      PulseSpan(PulsesView pulses, int number, byte multiply, float rssi, unsigned long time)
+          : Pulses(pulses), Number(number), Multiply(multiply), rssi(rssi), Time(time) {}
+      /// over the pulses of RawSignal, of a queued frame, of whatever stores them like RawSignal
+      template <typename SignalType>
+      explicit PulseSpan(const SignalType &signal)
+          : PulseSpan(signal.Pulses, signal.Number, signal.Multiply, signal.rssi, signal.Time) {}
+
+      /**
+       * Statistics of the pulses, see 19_FrameFeatures.h. Computed on the first call for a frame
+       * given to PluginRXCall(), then shared by all the plugins it calls.
+       * */
+      const FrameFeatures &features() const;
+      FrameFeatures *featuresCache = nullptr; // where features() keeps them
+    };
+
+    class PulseSource;
+
 
     namespace params {
       // All json variable names
       extern bool async_mode_enabled;
+      extern bool async_edge_capture_enabled;
       extern unsigned short int sample_rate;
       extern unsigned long int min_raw_pulses;
       extern unsigned long int seek_timeout;        // milliseconds
@@ -87,17 +214,49 @@ namespace RFLink {
       extern unsigned long int signal_end_timeout;  // microseconds
       extern unsigned long int signal_repeat_time;  // milliseconds
       extern unsigned long int scan_high_time;      // milliseconds
+      extern unsigned long int rssi_sample_interval; // microseconds
+      extern bool noise_gate_enabled;
+      extern unsigned long int noise_gate_max_clusters;
+      extern unsigned long int noise_gate_max_spread;   // percent
+      extern unsigned long int noise_gate_max_outliers; // percent
     }
 
     namespace runtime {
       extern bool verboseSignalFetchLoop;
       extern Slicer_enum appliedSlicer;
+      extern PulseSource *pulseSource; // where synchronous slicers read levels, time and RSSI from
+      extern float rssiGapEarly_dB;     // RSSI_GAP_EARLY_DB unless the noise floor estimator raised it
+      extern float rssiGapLongPulse_dB; // RSSI_GAP_LONG_PULSE_DB unless the noise floor estimator raised it
+      extern float rssiGapMin_dBm;      // a RSSI rise below this level is noise, -9999 while the noise floor is unknown
     }
 
     namespace counters {
       extern unsigned long int receivedSignalsCount;
       extern unsigned long int successfullyDecodedSignalsCount;
-
+      extern unsigned long int skippedRepeatsCount; // frames identical to a recently decoded one, not given to the plugins
+      extern unsigned long int votedFramesCount;    // frames only decoded once their repeats were voted into a clean one
+      extern unsigned long int realignedFramesCount; // frames only decoded once their first pulses were skipped
+      extern unsigned long int gatedFrames[GateReasons::GATE_REASONS_EOF];            // frames thrown away by the noise gate, per reason
+      extern volatile unsigned long int droppedSignals[DropReasons::DROP_REASONS_EOF]; // signals thrown away by the slicers, per reason
+      extern unsigned long int endedSignals[EndReasons::REASONS_EOF];                 // signals given to the decoder, per end reason
+      extern volatile unsigned long int droppedPulseCounts[PULSE_COUNT_BUCKETS];      // signals thrown away by the slicers, per log2 of their number of pulses
+      extern unsigned long int acceptedPulseCounts[PULSE_COUNT_BUCKETS];             // signals given to the decoder, per log2 of their number of pulses
+      struct SlicerCounters {
+        unsigned long int accepted;
+        unsigned long int dropped[DropReasons::DROP_REASONS_EOF];
+      };
+      extern volatile SlicerCounters slicers[Slicer_enum::SLICERS_EOF]; // same as above, for the slicer which was applied at the time
+      extern volatile unsigned long int asyncFrameQueueOverruns;     // frames lost because every slot was waiting for the decoder
+      extern volatile unsigned short int asyncFrameQueueHighWaterMark; // highest number of frames ever waiting for the decoder
+      extern unsigned long int asyncEdgeBufferOverruns;                // edge capture: frames broken because the main loop was too late to collect the edges
+      extern unsigned long int asyncDecodeLatency[ASYNC_LATENCY_BUCKETS]; // frames per time from their last edge to the start of their decoding
+      extern unsigned long int asyncDecodeLatencyMax_us;
+      #ifdef RFLINK_SIGNAL_ISR_STATS
+      extern volatile unsigned long int asyncIsrCalls;
+      extern volatile uint32_t asyncIsrCyclesMin;
+      extern volatile uint32_t asyncIsrCyclesMax;
+      extern volatile uint64_t asyncIsrCyclesTotal;
+      #endif
     }
 
     extern Config::ConfigItem configItems[];
@@ -109,13 +268,76 @@ namespace RFLink {
     void AC_Send(unsigned long data, byte cmd);
 
     void executeCliCommand(char *cmd);
+    bool getSignalFromJson(RawSignalStruct &signal, const char *json_str);
 
     bool ScanEvent();
+    /**
+     * Runs the applied synchronous slicer once on runtime::pulseSource
+     * @return true if a signal was captured in RawSignal
+     * */
+    bool fetchSignal();
     void getStatusJsonString(JsonObject &output);
 
+    /**
+     * Hash of the pulse train with every pulse rounded to a multiple of the shortest one,
+     * so the repeats of a frame get the same fingerprint despite the timing jitter.
+     * @return 0 if the signal is too short to be fingerprinted
+     * */
+    unsigned long computeFingerprint(const PulseSpan &frame);
+
+    /**
+     * Frames made of back to back repeats, too long or too damaged for the plugins, are split at their long gaps.
+     * The segments sharing the most frequent length are the repeats: each of their pulses is voted across them,
+     * which cleans a pulse broken by noise in a minority of the repeats.
+     * */
+    namespace RepeatVoting
+    {
+      /**
+       * Copies frame into an internal buffer if it has enough long gaps to be made of repeats, before the plugins
+       * which may modify it. The vote itself is left to decodeVoted(), once the plugins have failed on the frame.
+       * @return false if the frame cannot be voted
+       * */
+      bool keep(const PulseSpan &frame);
+      /**
+       * Votes the repeats of the signal kept last and gives the voted frame to the plugins,
+       * RawSignal is only overwritten if a plugin not using PulseSpan is tried
+       * @return false if the signal is not made of enough repeats, or no plugin decodes the voted frame
+       * */
+      bool decodeVoted();
+    }
+
+    /**
+     * Frames of a noisy band which pass min_raw_pulses are mostly garbage: the gate scores a frame with cheap statistics
+     * so that those which clearly are not OOK data never reach the plugins, nor the debug output.
+     * OOK data has a few pulse lengths (short and long, a sync, a separator) around which its pulses are tight.
+     * The pulse lengths are put in quarters of octave, whose runs make the clusters.
+     * */
+    namespace NoiseGate
+    {
+      /**
+       * Counts the frame in counters::gatedFrames when it is noise
+       * @return true if no plugin should be given the frame
+       * */
+      bool isNoise(const PulseSpan &frame);
+    }
+
+    /**
+     * Gives RawSignal to the plugins again as if it started 2, 4... pulses later, up to REALIGN_MAX_SKIPPED_PULSES,
+     * for frames whose first pulses are noise in front of the preamble. Nothing is copied, see PulsesWindow.
+     * @return true if a plugin has handled one of the windows
+     * */
+    bool decodeRealigned();
+
     void displaySignal(RawSignalStruct &signal);
 
     const char * endReasonToString(EndReasons reason);
+    const char * dropReasonToString(DropReasons reason);
+    const char * gateReasonToString(GateReasons reason);
+    const char * slicerIdToString(Slicer_enum slicer);
+    /**
+     * Zeroes the drop, end reason, gate, pulse count and per slicer counters
+     * */
+    void resetDropStats();
 
     inline void setVerboseSignalFetchLoop(bool value=true) {
       runtime::verboseSignalFetchLoop = value;
@@ -123,9 +345,33 @@ namespace RFLink {
 
     bool updateSlicer(Slicer_enum newSlicer);
 
+    /**
+     * @param source nullptr to go back to the receiver pins
+     * */
+    void setPulseSource(PulseSource *source);
+
     namespace AsyncSignalScanner {
+      /**
+       * One slot of the queue between RX_pin_changed_state() (producer) and ScanEvent() (consumer).
+       * The interrupt fills the slot at queue head, the plugins are given the one at queue tail where it is.
+       * */
+      struct CapturedFrame
+      {
+        int Number;
+        byte Multiply;
+        unsigned long Time;
+        float rssi;           // highest RSSI read by checkLongPulseRssi() during the frame
+        unsigned long lastEdge_us;
+        EndReasons endReason;
+        #ifdef RFLINK_SIGNAL_COMPACT_PULSES
+        CompactPulses<RAW_BUFFER_SIZE + 1> Pulses;
+        #else
+        ShiftablePulses<RAW_BUFFER_SIZE + 1> Pulses;
+        #endif
+      };
+
       extern unsigned long int lastChangedState_us;     // time last state change occured
-      extern unsigned long int nextPulseTimeoutTime_us; // when current pulse will timeout
+      extern volatile unsigned long int nextPulseTimeoutTime_us; // when current pulse will timeout
       extern bool scanningStopped;                      // 
 
       void enableAsyncReceiver();
@@ -140,9 +386,30 @@ namespace RFLink {
       void stopScanning();
       void clearAllTimers();
       void IRAM_ATTR RX_pin_changed_state();
-      void onPulseTimerTimeout();
-
-      bool getSignalFromJson(RawSignalStruct &signal, const char *json_str);
+      /**
+       * Interrupt of the edge capture mode: only records the time since the previous edge and the new pin level,
+       * processCapturedEdges() does the rest in the main loop.
+       * */
+      void IRAM_ATTR RX_pin_edge_recorded();
+      /**
+       * Edge capture mode: turns the edges recorded by the interrupt into frames and detects their end
+       * */
+      void processCapturedEdges();
+      /**
+       * RSSI_Advanced slicer: restarts the frame being captured when the RSSI rises within a long pulse,
+       * receivers with high gains can keep their output high on noise until a real signal comes.
+       * Reads the RSSI, must be called from the main loop.
+       * */
+      void checkLongPulseRssi();
+      void IRAM_ATTR onPulseTimerTimeout();
+      /**
+       * Oldest completed frame, to be decoded in its slot: the interrupt does not reuse it until releaseCapturedFrame()
+       * @return nullptr if no frame is waiting for the decoder
+       * */
+      CapturedFrame *peekCapturedFrame();
+      /// Frees the slot of the frame given by peekCapturedFrame()
+      void releaseCapturedFrame();
+      unsigned short int pendingFramesCount();
 
       inline bool isStopped() {
         return scanningStopped;
@@ -151,6 +418,35 @@ namespace RFLink {
       inline bool isEnabled() {
         return params::async_mode_enabled;
       };
+
+      inline bool isEdgeCaptureEnabled() {
+        return params::async_edge_capture_enabled;
+      };
+
+      /// true while a frame is being captured, the receiver only hears noise otherwise
+      inline bool isCapturing() {
+        return nextPulseTimeoutTime_us != 0;
+      };
+
+      void resetIsrStats();
+      void resetLatencyStats();
+
+      #ifdef RFLINK_ASYNC_DECODE_TASK
+      /**
+       * The decode task uses RawSignal, pbuffer and the plugins, any other user has to hold this lock (recursive).
+       * */
+      void lockDecoder();
+      void unlockDecoder();
+      /**
+       * Moves the oldest message decoded by the task to pbuffer, if pbuffer is free.
+       * @return true if there is a message to send
+       * */
+      bool takeDecodedMessage();
+      bool isDecodeTaskRunning();
+      #else
+      inline void lockDecoder() {}
+      inline void unlockDecoder() {}
+      #endif
     };
 
   } // end of ns Signal
@@ -9,6 +9,7 @@
 #include "RFLink.h"
 #include "3_Serial.h"
 #include "4_Display.h"
+#include "2_Signal.h"
 
 byte PKSequenceNumber = 0;       // 1 byte packet counter
 char dbuffer[60];                // Buffer for message chunk data
@@ -747,3 +748,142 @@ String GPIO2String(uint8_t uGPIO)
     return "NOT_A_PIN";
 }
 #endif // ESP32
+
+#ifndef LINE_WRITER_BUFFER_SIZE
+#define LINE_WRITER_BUFFER_SIZE 256 // longer lines are sent in several writes
+#endif
+
+namespace RFLink
+{
+  static char lineWriterBuffer[LINE_WRITER_BUFFER_SIZE];
+  static size_t lineWriterLength = 0;
+
+  LineWriter::LineWriter()
+  {
+    Signal::AsyncSignalScanner::lockDecoder(); // the decode task prints too
+  }
+
+  LineWriter::~LineWriter()
+  {
+    flush();
+    Signal::AsyncSignalScanner::unlockDecoder();
+  }
+
+  void LineWriter::put(char c)
+  {
+    if (lineWriterLength == sizeof(lineWriterBuffer))
+      flush();
+    lineWriterBuffer[lineWriterLength++] = c;
+  }
+
+  LineWriter &LineWriter::print(const char *text)
+  {
+    while (*text != 0)
+      put(*text++);
+    return *this;
+  }
+
+  LineWriter &LineWriter::print(const __FlashStringHelper *text)
+  {
+    PGM_P p = reinterpret_cast<PGM_P>(text);
+    char c;
+    while ((c = pgm_read_byte(p++)) != 0)
+      put(c);
+    return *this;
+  }
+
+  LineWriter &LineWriter::print(char c)
+  {
+    put(c);
+    return *this;
+  }
+
+  LineWriter &LineWriter::print(unsigned long n)
+  {
+    char digits[10];
+    byte count = 0;
+    do
+    {
+      digits[count++] = '0' + n % 10;
+      n /= 10;
+    } while (n != 0);
+    while (count > 0)
+      put(digits[--count]);
+    return *this;
+  }
+
+  LineWriter &LineWriter::print(long n)
+  {
+    if (n < 0)
+    {
+      put('-');
+      return print(0UL - (unsigned long)n);
+    }
+    return print((unsigned long)n);
+  }
+
+  LineWriter &LineWriter::print(float f, byte decimals)
+  {
+    if (isnan(f))
+      return print(F("nan"));
+    if (f < 0)
+    {
+      put('-');
+      f = -f;
+    }
+    if (f > 4294967040.0F)
+      return print(F("ovf"));
+
+    float rounding = 0.5F;
+    for (byte i = 0; i < decimals; i++)
+      rounding /= 10;
+    f += rounding;
+
+    unsigned long integer = (unsigned long)f;
+    print(integer);
+    if (decimals > 0)
+      put('.');
+    float remainder = f - integer;
+    for (byte i = 0; i < decimals; i++)
+    {
+      remainder *= 10;
+      byte digit = (byte)remainder;
+      put('0' + digit);
+      remainder -= digit;
+    }
+    return *this;
+  }
+
+  LineWriter &LineWriter::printHex(unsigned long n, byte minDigits, bool upperCase)
+  {
+    const char letters = upperCase ? 'A' : 'a';
+    char digits[8];
+    byte count = 0;
+    do
+    {
+      byte nibble = n & 0x0F;
+      digits[count++] = nibble < 10 ? '0' + nibble : letters + nibble - 10;
+      n >>= 4;
+    } while (n != 0);
+    for (byte i = count; i < minDigits; i++)
+      put('0');
+    while (count > 0)
+      put(digits[--count]);
+    return *this;
+  }
+
+  void LineWriter::println()
+  {
+    put('\r');
+    put('\n');
+    flush();
+  }
+
+  void LineWriter::flush()
+  {
+    if (lineWriterLength == 0)
+      return;
+    sendRawData(lineWriterBuffer, lineWriterLength);
+    lineWriterLength = 0;
+  }
+}
@@ -139,4 +139,40 @@ uint8_t String2GPIO(String);
 String GPIO2String(uint8_t uGPIO);
 #endif // ESP8266 || ESP32
 
+namespace RFLink
+{
+  /**
+   * Builds a line of output in a fixed buffer, formatting numbers itself, and hands it to every output
+   * (Serial, Serial2Net clients) in a single write when the line ends or the buffer is full.
+   * No heap allocation at all, meant to be declared on the stack of the function printing the line.
+   * All the writers share a single small static buffer, sent each time it is full. A writer holds the decoder lock
+   * while it exists, so the writes of a long line are not mixed with the output of the other task, and a writer
+   * declared while another is alive appends to the same line.
+   * */
+  class LineWriter
+  {
+  public:
+    LineWriter();
+    ~LineWriter();
+
+    LineWriter &print(const char *text);
+    LineWriter &print(const __FlashStringHelper *text);
+    LineWriter &print(char c);
+    LineWriter &print(unsigned long n);
+    LineWriter &print(long n);
+    inline LineWriter &print(unsigned int n) { return print((unsigned long)n); }
+    inline LineWriter &print(int n) { return print((long)n); }
+    /// Rounded to the given number of decimals, "nan" when not a number
+    LineWriter &print(float f, byte decimals = 2);
+    /// Padded with zeros up to minDigits
+    LineWriter &printHex(unsigned long n, byte minDigits = 2, bool upperCase = true);
+    /// Ends the line with \r\n and sends it
+    void println();
+    void flush();
+
+  private:
+    void put(char c);
+  };
+}
+
 #endif
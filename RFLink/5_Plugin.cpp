@@ -10,6 +10,8 @@
 #include "2_Signal.h"
 #include "5_Plugin.h"
 #include "7_Utils.h"
+#include "15_DedupCache.h"
+#include "19_FrameFeatures.h"
 
 using namespace RFLink::Utils;
 using namespace RFLink::Signal;
@@ -17,8 +19,11 @@ using namespace RFLink;
 
 
 boolean (*Plugin_ptr[PLUGIN_MAX])(byte, const char *); // Receive plugins
+boolean (*PluginSpan_ptr[PLUGIN_MAX])(const PulseSpan &); // Receive plugins reading a PulseSpan
 byte Plugin_id[PLUGIN_MAX];
 byte Plugin_State[PLUGIN_MAX];
+const PluginPulsesRange *Plugin_PulsesRanges[PLUGIN_MAX]; // nullptr: any pulse count
+byte Plugin_PulsesRangesCount[PLUGIN_MAX];
 #ifndef ARDUINO_AVR_UNO // Optimize memory limite to 2048 bytes on arduino uno
 const char* Plugin_Description[PLUGIN_MAX];
 #endif
@@ -32,6 +37,25 @@ boolean QRFDebug = QRFDebug_0;   // debug RF signals with plugin 001 but no mult
 boolean RFUDebug = RFUDebug_0;   // debug RF signals with plugin 254 (decode 1st)
 boolean QRFUDebug = QRFUDebug_0; // debug RF signals with plugin 254 but no multiplication (faster?, compact)
 
+// Pulse count dispatch table: the pulse counts are cut into segments where the same plugins apply,
+// segment i starts at segmentStart[i] and its candidates are candidates[candidatesOffset[i]..candidatesOffset[i+1]-1],
+// in RFLink::Plugins::runtime::order.
+namespace dispatch
+{
+  bool ready = false;
+  byte segmentsCount = 0;
+  uint16_t segmentStart[PLUGIN_DISPATCH_SEGMENTS_MAX];
+  uint16_t candidatesOffset[PLUGIN_DISPATCH_SEGMENTS_MAX + 1];
+  byte candidates[PLUGIN_DISPATCH_CANDIDATES_MAX];
+}
+
+#define SET_PLUGIN_PULSES(x, ...)                                         \
+  {                                                                       \
+    static const PluginPulsesRange ranges[] = {__VA_ARGS__};              \
+    Plugin_PulsesRanges[x] = ranges;                                      \
+    Plugin_PulsesRangesCount[x] = sizeof(ranges) / sizeof(ranges[0]);     \
+  }
+
 /**********************************************************************************************\
  * Load plugins
 \*********************************************************************************************/
@@ -550,8 +574,11 @@ void PluginInit(void)
   for (x = 0; x < PLUGIN_MAX; x++)
   {
     Plugin_ptr[x] = 0;
+    PluginSpan_ptr[x] = nullptr;
     Plugin_id[x] = 0;
     Plugin_State[x] = P_Disabled;
+    Plugin_PulsesRanges[x] = nullptr;
+    Plugin_PulsesRangesCount[x] = 0;
   }
 
   x = 0;
@@ -562,6 +589,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_001);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_001
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_001);
+#endif
   Plugin_ptr[x++] = &Plugin_001;
 #endif
 
@@ -571,6 +601,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_002);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_002
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_002);
+#endif
   Plugin_ptr[x++] = &Plugin_002;
 #endif
 
@@ -580,6 +613,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_003);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_003
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_003);
+#endif
   Plugin_ptr[x++] = &Plugin_003;
 #endif
 
@@ -589,6 +625,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_004);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_004
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_004);
+#endif
   Plugin_ptr[x++] = &Plugin_004;
 #endif
 
@@ -598,6 +637,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_005);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_005
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_005);
+#endif
   Plugin_ptr[x++] = &Plugin_005;
 #endif
 
@@ -607,6 +649,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_006);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_006
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_006);
+#endif
+  PluginSpan_ptr[x] = &Plugin_006;
   Plugin_ptr[x++] = &Plugin_006;
 #endif
 
@@ -616,6 +662,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_007);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_007
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_007);
+#endif
   Plugin_ptr[x++] = &Plugin_007;
 #endif
 
@@ -625,6 +674,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_008);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_008
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_008);
+#endif
+  PluginSpan_ptr[x] = &Plugin_008;
   Plugin_ptr[x++] = &Plugin_008;
 #endif
 
@@ -634,6 +687,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_009);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_009
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_009);
+#endif
+  PluginSpan_ptr[x] = &Plugin_009;
   Plugin_ptr[x++] = &Plugin_009;
 #endif
 
@@ -643,6 +700,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_010);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_010
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_010);
+#endif
   Plugin_ptr[x++] = &Plugin_010;
 #endif
 
@@ -652,6 +712,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_011);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_011
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_011);
+#endif
   Plugin_ptr[x++] = &Plugin_011;
 #endif
 
@@ -661,6 +724,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_012);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_012
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_012);
+#endif
+  PluginSpan_ptr[x] = &Plugin_012;
   Plugin_ptr[x++] = &Plugin_012;
 #endif
 
@@ -670,6 +737,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_013);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_013
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_013);
+#endif
   Plugin_ptr[x++] = &Plugin_013;
 #endif
 
@@ -679,6 +749,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_014);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_014
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_014);
+#endif
   Plugin_ptr[x++] = &Plugin_014;
 #endif
 
@@ -688,6 +761,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_015);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_015
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_015);
+#endif
   Plugin_ptr[x++] = &Plugin_015;
 #endif
 
@@ -697,6 +773,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_016);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_016
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_016);
+#endif
   Plugin_ptr[x++] = &Plugin_016;
 #endif
 
@@ -706,6 +785,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_017);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_017
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_017);
+#endif
   Plugin_ptr[x++] = &Plugin_017;
 #endif
 
@@ -715,6 +797,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_018);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_018
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_018);
+#endif
   Plugin_ptr[x++] = &Plugin_018;
 #endif
 
@@ -724,6 +809,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_019);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_019
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_019);
+#endif
   Plugin_ptr[x++] = &Plugin_019;
 #endif
 
@@ -733,6 +821,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_020);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_020
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_020);
+#endif
   Plugin_ptr[x++] = &Plugin_020;
 #endif
 
@@ -742,6 +833,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_021);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_021
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_021);
+#endif
   Plugin_ptr[x++] = &Plugin_021;
 #endif
 
@@ -751,6 +845,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_022);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_022
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_022);
+#endif
   Plugin_ptr[x++] = &Plugin_022;
 #endif
 
@@ -760,6 +857,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_023);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_023
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_023);
+#endif
   Plugin_ptr[x++] = &Plugin_023;
 #endif
 
@@ -769,6 +869,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_024);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_024
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_024);
+#endif
   Plugin_ptr[x++] = &Plugin_024;
 #endif
 
@@ -778,6 +881,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_025);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_025
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_025);
+#endif
   Plugin_ptr[x++] = &Plugin_025;
 #endif
 
@@ -787,6 +893,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_026);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_026
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_026);
+#endif
   Plugin_ptr[x++] = &Plugin_026;
 #endif
 
@@ -796,6 +905,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_027);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_027
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_027);
+#endif
   Plugin_ptr[x++] = &Plugin_027;
 #endif
 
@@ -805,6 +917,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_028);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_028
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_028);
+#endif
   Plugin_ptr[x++] = &Plugin_028;
 #endif
 
@@ -814,6 +929,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_029);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_029
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_029);
+#endif
   Plugin_ptr[x++] = &Plugin_029;
 #endif
 
@@ -823,6 +941,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_030);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_030
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_030);
+#endif
   Plugin_ptr[x++] = &Plugin_030;
 #endif
 
@@ -832,6 +953,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_031);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_031
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_031);
+#endif
+  PluginSpan_ptr[x] = &Plugin_031;
   Plugin_ptr[x++] = &Plugin_031;
 #endif
 
@@ -841,6 +966,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_032);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_032
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_032);
+#endif
   Plugin_ptr[x++] = &Plugin_032;
 #endif
 
@@ -850,6 +978,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_033);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_033
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_033);
+#endif
   Plugin_ptr[x++] = &Plugin_033;
 #endif
 
@@ -859,6 +990,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_034);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_034
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_034);
+#endif
   Plugin_ptr[x++] = &Plugin_034;
 #endif
 
@@ -868,6 +1002,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_035);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_035
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_035);
+#endif
   Plugin_ptr[x++] = &Plugin_035;
 #endif
 
@@ -877,6 +1014,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_036);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_036
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_036);
+#endif
+  PluginSpan_ptr[x] = &Plugin_036;
   Plugin_ptr[x++] = &Plugin_036;
 #endif
 
@@ -886,6 +1027,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_037);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_037
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_037);
+#endif
+  PluginSpan_ptr[x] = &Plugin_037;
   Plugin_ptr[x++] = &Plugin_037;
 #endif
 
@@ -895,6 +1040,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_038);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_038
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_038);
+#endif
   Plugin_ptr[x++] = &Plugin_038;
 #endif
 
@@ -904,6 +1052,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_039);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_039
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_039);
+#endif
   Plugin_ptr[x++] = &Plugin_039;
 #endif
 
@@ -913,6 +1064,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_040);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_040
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_040);
+#endif
   Plugin_ptr[x++] = &Plugin_040;
 #endif
 
@@ -922,6 +1076,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_041);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_041
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_041);
+#endif
   Plugin_ptr[x++] = &Plugin_041;
 #endif
 
@@ -931,6 +1088,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_042);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_042
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_042);
+#endif
   Plugin_ptr[x++] = &Plugin_042;
 #endif
 
@@ -940,6 +1100,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_043);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_043
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_043);
+#endif
   Plugin_ptr[x++] = &Plugin_043;
 #endif
 
@@ -949,6 +1112,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_044);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_044
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_044);
+#endif
   Plugin_ptr[x++] = &Plugin_044;
 #endif
 
@@ -958,6 +1124,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_045);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_045
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_045);
+#endif
   Plugin_ptr[x++] = &Plugin_045;
 #endif
 
@@ -967,6 +1136,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_046);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_046
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_046);
+#endif
+  PluginSpan_ptr[x] = &Plugin_046;
   Plugin_ptr[x++] = &Plugin_046;
 #endif
 
@@ -976,6 +1149,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_047);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_047
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_047);
+#endif
   Plugin_ptr[x++] = &Plugin_047;
 #endif
 
@@ -985,6 +1161,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_048);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_048
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_048);
+#endif
   Plugin_ptr[x++] = &Plugin_048;
 #endif
 
@@ -994,6 +1173,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_049);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_049
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_049);
+#endif
+  PluginSpan_ptr[x] = &Plugin_049;
   Plugin_ptr[x++] = &Plugin_049;
 #endif
 
@@ -1003,6 +1186,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_050);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_050
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_050);
+#endif
   Plugin_ptr[x++] = &Plugin_050;
 #endif
 
@@ -1012,6 +1198,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_051);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_051
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_051);
+#endif
   Plugin_ptr[x++] = &Plugin_051;
 #endif
 
@@ -1021,6 +1210,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_052);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_052
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_052);
+#endif
   Plugin_ptr[x++] = &Plugin_052;
 #endif
 
@@ -1030,6 +1222,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_053);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_053
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_053);
+#endif
   Plugin_ptr[x++] = &Plugin_053;
 #endif
 
@@ -1039,6 +1234,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_054);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_054
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_054);
+#endif
   Plugin_ptr[x++] = &Plugin_054;
 #endif
 
@@ -1048,6 +1246,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_055);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_055
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_055);
+#endif
   Plugin_ptr[x++] = &Plugin_055;
 #endif
 
@@ -1057,6 +1258,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_056);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_056
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_056);
+#endif
   Plugin_ptr[x++] = &Plugin_056;
 #endif
 
@@ -1066,6 +1270,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_057);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_057
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_057);
+#endif
   Plugin_ptr[x++] = &Plugin_057;
 #endif
 
@@ -1075,6 +1282,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_058);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_058
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_058);
+#endif
   Plugin_ptr[x++] = &Plugin_058;
 #endif
 
@@ -1084,6 +1294,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_059);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_059
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_059);
+#endif
   Plugin_ptr[x++] = &Plugin_059;
 #endif
 
@@ -1093,6 +1306,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_060);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_060
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_060);
+#endif
   Plugin_ptr[x++] = &Plugin_060;
 #endif
 
@@ -1102,6 +1318,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_061);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_061
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_061);
+#endif
+  PluginSpan_ptr[x] = &Plugin_061;
   Plugin_ptr[x++] = &Plugin_061;
 #endif
 
@@ -1111,6 +1331,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_062);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_062
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_062);
+#endif
   Plugin_ptr[x++] = &Plugin_062;
 #endif
 
@@ -1120,6 +1343,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_063);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_063
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_063);
+#endif
   Plugin_ptr[x++] = &Plugin_063;
 #endif
 
@@ -1129,6 +1355,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_064);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_064
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_064);
+#endif
   Plugin_ptr[x++] = &Plugin_064;
 #endif
 
@@ -1138,6 +1367,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_065);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_065
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_065);
+#endif
   Plugin_ptr[x++] = &Plugin_065;
 #endif
 
@@ -1147,6 +1379,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_066);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_066
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_066);
+#endif
   Plugin_ptr[x++] = &Plugin_066;
 #endif
 
@@ -1156,6 +1391,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_067);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_067
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_067);
+#endif
   Plugin_ptr[x++] = &Plugin_067;
 #endif
 
@@ -1165,6 +1403,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_068);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_068
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_068);
+#endif
   Plugin_ptr[x++] = &Plugin_068;
 #endif
 
@@ -1174,6 +1415,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_069);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_069
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_069);
+#endif
   Plugin_ptr[x++] = &Plugin_069;
 #endif
 
@@ -1183,6 +1427,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_070);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_070
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_070);
+#endif
   Plugin_ptr[x++] = &Plugin_070;
 #endif
 
@@ -1192,6 +1439,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_071);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_071
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_071);
+#endif
   Plugin_ptr[x++] = &Plugin_071;
 #endif
 
@@ -1201,6 +1451,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_072);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_072
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_072);
+#endif
   Plugin_ptr[x++] = &Plugin_072;
 #endif
 
@@ -1210,6 +1463,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_073);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_073
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_073);
+#endif
   Plugin_ptr[x++] = &Plugin_073;
 #endif
 
@@ -1219,6 +1475,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_074);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_074
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_074);
+#endif
+  PluginSpan_ptr[x] = &Plugin_074;
   Plugin_ptr[x++] = &Plugin_074;
 #endif
 
@@ -1228,6 +1488,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_075);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_075
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_075);
+#endif
   Plugin_ptr[x++] = &Plugin_075;
 #endif
 
@@ -1237,6 +1500,10 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_076);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_076
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_076);
+#endif
+  PluginSpan_ptr[x] = &Plugin_076;
   Plugin_ptr[x++] = &Plugin_076;
 #endif
 
@@ -1246,6 +1513,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_077);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_077
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_077);
+#endif
   Plugin_ptr[x++] = &Plugin_077;
 #endif
 
@@ -1255,6 +1525,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_078);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_078
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_078);
+#endif
   Plugin_ptr[x++] = &Plugin_078;
 #endif
 
@@ -1264,6 +1537,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_079);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_079
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_079);
+#endif
   Plugin_ptr[x++] = &Plugin_079;
 #endif
 
@@ -1273,6 +1549,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_080);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_080
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_080);
+#endif
   Plugin_ptr[x++] = &Plugin_080;
 #endif
 
@@ -1282,6 +1561,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_081);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_081
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_081);
+#endif
   Plugin_ptr[x++] = &Plugin_081;
 #endif
 
@@ -1291,6 +1573,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_082);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_082
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_082);
+#endif
   Plugin_ptr[x++] = &Plugin_082;
 #endif
 
@@ -1300,6 +1585,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_083);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_083
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_083);
+#endif
   Plugin_ptr[x++] = &Plugin_083;
 #endif
 
@@ -1309,6 +1597,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_084);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_084
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_084);
+#endif
   Plugin_ptr[x++] = &Plugin_084;
 #endif
 
@@ -1318,6 +1609,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_085);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_085
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_085);
+#endif
   Plugin_ptr[x++] = &Plugin_085;
 #endif
 
@@ -1327,6 +1621,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_086);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_086
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_086);
+#endif
   Plugin_ptr[x++] = &Plugin_086;
 #endif
 
@@ -1336,6 +1633,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_087);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_087
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_087);
+#endif
   Plugin_ptr[x++] = &Plugin_087;
 #endif
 
@@ -1345,6 +1645,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_088);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_088
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_088);
+#endif
   Plugin_ptr[x++] = &Plugin_088;
 #endif
 
@@ -1354,6 +1657,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_089);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_089
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_089);
+#endif
   Plugin_ptr[x++] = &Plugin_089;
 #endif
 
@@ -1363,6 +1669,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_090);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_090
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_090);
+#endif
   Plugin_ptr[x++] = &Plugin_090;
 #endif
 
@@ -1372,6 +1681,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_091);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_091
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_091);
+#endif
   Plugin_ptr[x++] = &Plugin_091;
 #endif
 
@@ -1381,6 +1693,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_092);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_092
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_092);
+#endif
   Plugin_ptr[x++] = &Plugin_092;
 #endif
 
@@ -1390,6 +1705,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_093);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_093
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_093);
+#endif
   Plugin_ptr[x++] = &Plugin_093;
 #endif
 
@@ -1399,6 +1717,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_094);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_094
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_094);
+#endif
   Plugin_ptr[x++] = &Plugin_094;
 #endif
 
@@ -1408,6 +1729,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_095);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_095
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_095);
+#endif
   Plugin_ptr[x++] = &Plugin_095;
 #endif
 
@@ -1417,6 +1741,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_096);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_096
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_096);
+#endif
   Plugin_ptr[x++] = &Plugin_096;
 #endif
 
@@ -1426,6 +1753,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_097);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_097
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_097);
+#endif
   Plugin_ptr[x++] = &Plugin_097;
 #endif
 
@@ -1435,6 +1765,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_098);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_098
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_098);
+#endif
   Plugin_ptr[x++] = &Plugin_098;
 #endif
 
@@ -1444,6 +1777,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_099);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_099
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_099);
+#endif
   Plugin_ptr[x++] = &Plugin_099;
 #endif
 
@@ -1453,6 +1789,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_100);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_100
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_100);
+#endif
   Plugin_ptr[x++] = &Plugin_100;
 #endif
 
@@ -1462,6 +1801,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_101);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_101
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_101);
+#endif
   Plugin_ptr[x++] = &Plugin_101;
 #endif
 
@@ -1471,6 +1813,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_102);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_102
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_102);
+#endif
   Plugin_ptr[x++] = &Plugin_102;
 #endif
 
@@ -1480,6 +1825,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_103);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_103
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_103);
+#endif
   Plugin_ptr[x++] = &Plugin_103;
 #endif
 
@@ -1489,6 +1837,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_104);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_104
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_104);
+#endif
   Plugin_ptr[x++] = &Plugin_104;
 #endif
 
@@ -1498,6 +1849,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_105);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_105
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_105);
+#endif
   Plugin_ptr[x++] = &Plugin_105;
 #endif
 
@@ -1507,6 +1861,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_106);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_106
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_106);
+#endif
   Plugin_ptr[x++] = &Plugin_106;
 #endif
 
@@ -1516,6 +1873,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_107);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_107
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_107);
+#endif
   Plugin_ptr[x++] = &Plugin_107;
 #endif
 
@@ -1525,6 +1885,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_108);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_108
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_108);
+#endif
   Plugin_ptr[x++] = &Plugin_108;
 #endif
 
@@ -1534,6 +1897,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_109);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_109
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_109);
+#endif
   Plugin_ptr[x++] = &Plugin_109;
 #endif
 
@@ -1543,6 +1909,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_110);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_110
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_110);
+#endif
   Plugin_ptr[x++] = &Plugin_110;
 #endif
 
@@ -1552,6 +1921,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_111);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_111
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_111);
+#endif
   Plugin_ptr[x++] = &Plugin_111;
 #endif
 
@@ -1561,6 +1933,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_112);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_112
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_112);
+#endif
   Plugin_ptr[x++] = &Plugin_112;
 #endif
 
@@ -1570,6 +1945,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_113);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_113
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_113);
+#endif
   Plugin_ptr[x++] = &Plugin_113;
 #endif
 
@@ -1579,6 +1957,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_114);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_114
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_114);
+#endif
   Plugin_ptr[x++] = &Plugin_114;
 #endif
 
@@ -1588,6 +1969,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_115);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_115
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_115);
+#endif
   Plugin_ptr[x++] = &Plugin_115;
 #endif
 
@@ -1597,6 +1981,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_116);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_116
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_116);
+#endif
   Plugin_ptr[x++] = &Plugin_116;
 #endif
 
@@ -1606,6 +1993,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_117);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_117
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_117);
+#endif
   Plugin_ptr[x++] = &Plugin_117;
 #endif
 
@@ -1615,6 +2005,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_118);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_118
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_118);
+#endif
   Plugin_ptr[x++] = &Plugin_118;
 #endif
 
@@ -1624,6 +2017,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_119);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_119
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_119);
+#endif
   Plugin_ptr[x++] = &Plugin_119;
 #endif
 
@@ -1633,6 +2029,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_120);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_120
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_120);
+#endif
   Plugin_ptr[x++] = &Plugin_120;
 #endif
 
@@ -1642,6 +2041,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_250);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_250
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_250);
+#endif
   Plugin_ptr[x++] = &Plugin_250;
 #endif
 
@@ -1651,6 +2053,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_251);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_251
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_251);
+#endif
   Plugin_ptr[x++] = &Plugin_251;
 #endif
 
@@ -1660,6 +2065,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_252);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_252
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_252);
+#endif
   Plugin_ptr[x++] = &Plugin_252;
 #endif
 
@@ -1669,6 +2077,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_253);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_253
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_253);
+#endif
   Plugin_ptr[x++] = &Plugin_253;
 #endif
 
@@ -1678,6 +2089,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_254);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_254
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_254);
+#endif
   Plugin_ptr[x++] = &Plugin_254;
 #endif
 
@@ -1687,9 +2101,14 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_255);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_255
+  SET_PLUGIN_PULSES(x, PLUGIN_PULSES_255);
+#endif
   Plugin_ptr[x++] = &Plugin_255;
 #endif
 
+  RFLink::Plugins::updateOrder();
+
   // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGIN_INIT
   PluginInitCall(0, 0);
 }
@@ -2275,17 +2694,239 @@ byte PluginTXInitCall(byte Function, char *str)
 /*********************************************************************************************\
  * With this function plugins are called that have Receive functionality. 
  \*********************************************************************************************/
-byte PluginRXCall(byte Function, const char *str)
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+static inline void countCall(RFLink::Plugins::CallStats &stats, boolean matched, unsigned long elapsed_us)
+{
+  stats.calls++;
+  if (matched)
+    stats.matches++;
+  stats.time_us += elapsed_us;
+  if (elapsed_us > stats.maxTime_us)
+    stats.maxTime_us = elapsed_us;
+}
+#endif
+
+static inline boolean callRXPlugin(byte x, const PulseSpan &frame)
+{
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+  unsigned long start_us = micros();
+  boolean result = PluginSpan_ptr[x] != nullptr ? PluginSpan_ptr[x](frame) : Plugin_ptr[x](0, 0);
+  countCall(RFLink::Plugins::counters::rxStats[x], result, micros() - start_us);
+  return result;
+#else
+  return PluginSpan_ptr[x] != nullptr ? PluginSpan_ptr[x](frame) : Plugin_ptr[x](0, 0);
+#endif
+}
+
+static inline boolean callTXPlugin(byte x, byte Function, const char *str)
+{
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+  unsigned long start_us = micros();
+  boolean result = PluginTX_ptr[x](Function, str);
+  countCall(RFLink::Plugins::counters::txStats[x], result, micros() - start_us);
+  return result;
+#else
+  return PluginTX_ptr[x](Function, str);
+#endif
+}
+
+static bool pluginAcceptsPulses(byte x, uint16_t number)
+{
+  if (Plugin_PulsesRanges[x] == nullptr)
+    return true;
+
+  for (byte i = 0; i < Plugin_PulsesRangesCount[x]; i++)
+  {
+    if (number >= Plugin_PulsesRanges[x][i].min && number <= Plugin_PulsesRanges[x][i].max)
+      return true;
+  }
+  return false;
+}
+
+static void addSegmentStart(uint16_t start)
 {
+  byte i = dispatch::segmentsCount;
+
+  // insertion sort, ignoring duplicates
+  while (i > 0 && dispatch::segmentStart[i - 1] > start)
+    i--;
+  if (i > 0 && dispatch::segmentStart[i - 1] == start)
+    return;
+
+  memmove(&dispatch::segmentStart[i + 1], &dispatch::segmentStart[i], sizeof(uint16_t) * (dispatch::segmentsCount - i));
+  dispatch::segmentStart[i] = start;
+  dispatch::segmentsCount++;
+}
+
+/*********************************************************************************************\
+ * Builds the pulse count dispatch table from the ranges declared by the plugins.
+ * Returns false if it does not fit, PluginRXCall() then calls all plugins.
+ \*********************************************************************************************/
+bool PluginBuildDispatchTable()
+{
+  dispatch::ready = false;
+  dispatch::segmentsCount = 0;
+
+  // Worst case, every range adds two segment starts
+  unsigned int rangesCount = 0;
   for (byte x = 0; x < PLUGIN_MAX; x++)
   {
-    if ((Plugin_id[x] != 0) && (Plugin_State[x] >= P_Enabled))
+    if (Plugin_id[x] != 0 && Plugin_PulsesRanges[x] != nullptr)
+      rangesCount += Plugin_PulsesRangesCount[x];
+  }
+  if (rangesCount * 2 + 1 > PLUGIN_DISPATCH_SEGMENTS_MAX)
+    return false;
+
+  addSegmentStart(0);
+  for (byte x = 0; x < PLUGIN_MAX; x++)
+  {
+    if (Plugin_id[x] == 0 || Plugin_PulsesRanges[x] == nullptr)
+      continue;
+
+    for (byte i = 0; i < Plugin_PulsesRangesCount[x]; i++)
     {
-      SignalHash = x; // store plugin number
-      if (Plugin_ptr[x](Function, str))
-      {
-        SignalHashPrevious = SignalHash; // store previous plugin number after success
+      addSegmentStart(Plugin_PulsesRanges[x][i].min);
+      if (Plugin_PulsesRanges[x][i].max < PLUGIN_PULSES_MAX)
+        addSegmentStart(Plugin_PulsesRanges[x][i].max + 1);
+    }
+  }
+
+  uint16_t count = 0;
+  for (byte segment = 0; segment < dispatch::segmentsCount; segment++)
+  {
+    dispatch::candidatesOffset[segment] = count;
+
+    // all pulse counts of a segment are accepted by the same plugins, its first one tells which
+    for (byte i = 0; i < RFLink::Plugins::runtime::orderCount; i++)
+    {
+      byte x = RFLink::Plugins::runtime::order[i];
+      if (!pluginAcceptsPulses(x, dispatch::segmentStart[segment]))
+        continue;
+      if (count >= PLUGIN_DISPATCH_CANDIDATES_MAX)
+        return false;
+      dispatch::candidates[count++] = x;
+    }
+  }
+  dispatch::candidatesOffset[dispatch::segmentsCount] = count;
+
+  dispatch::ready = true;
+  return true;
+}
+
+static void lookupCandidates(uint16_t number, const byte *&candidate, const byte *&end)
+{
+  byte low = 0;
+  byte high = dispatch::segmentsCount - 1;
+
+  // last segment starting at or before number, segmentStart[0] is 0
+  while (low < high)
+  {
+    byte middle = (low + high + 1) / 2;
+    if (dispatch::segmentStart[middle] <= number)
+      low = middle;
+    else
+      high = middle - 1;
+  }
+
+  candidate = &dispatch::candidates[dispatch::candidatesOffset[low]];
+  end = &dispatch::candidates[dispatch::candidatesOffset[low + 1]];
+}
+
+static inline bool isRawSignal(const PulseSpan &frame)
+{
+  return frame.Pulses == PulseSpan(RawSignal).Pulses && frame.Number == RawSignal.Number && frame.Multiply == RawSignal.Multiply;
+}
+
+/// Puts a frame in RawSignal for the plugins which only read it, as if it had just been received
+static void copyToRawSignal(const PulseSpan &frame)
+{
+  RawSignal.Number = frame.Number;
+  RawSignal.Multiply = frame.Multiply;
+  RawSignal.rssi = frame.rssi;
+  RawSignal.Time = frame.Time;
+  RawSignal.Pulses[0] = 0;
+  for (int i = 1; i <= frame.Number; i++)
+    RawSignal.Pulses[i] = frame.Pulses[i];
+  if (frame.Number < RAW_BUFFER_SIZE)
+    RawSignal.Pulses[frame.Number + 1] = RFLink::Signal::params::signal_end_timeout;
+}
+
+/**
+ * Calls a plugin on frame, copies frame into RawSignal first if the plugin only reads RawSignal.
+ * Such a plugin may rewrite RawSignal, frame then becomes a view on what it has left,
+ * whose features are computed again as the plugin may have changed any pulse.
+ * */
+static bool tryRXPlugin(byte x, PulseSpan &frame, bool &inRawSignal)
+{
+  if (PluginSpan_ptr[x] == nullptr && !inRawSignal)
+  {
+    copyToRawSignal(frame);
+    inRawSignal = true;
+  }
+
+  SignalHash = x; // store plugin number
+  if (callRXPlugin(x, frame))
+  {
+    SignalHashPrevious = SignalHash; // store previous plugin number after success
+    RFLink::Plugins::countHit(x);
+    return true;
+  }
+
+  if (PluginSpan_ptr[x] == nullptr)
+  {
+    PulseSpan rewritten(RawSignal);
+    rewritten.featuresCache = frame.featuresCache;
+    rewritten.featuresCache->computed = false;
+    frame = rewritten;
+  }
+  return false;
+}
+
+byte PluginRXCall(byte Function, const char *str)
+{
+  return PluginRXCall(PulseSpan(RawSignal));
+}
+
+byte PluginRXCall(const PulseSpan &signal)
+{
+  static FrameFeatures features;
+  PulseSpan frame = signal;
+  bool inRawSignal = isRawSignal(frame);
+
+  features.computed = false; // on the first PulseSpan::features() call
+  frame.featuresCache = &features;
+
+  if (!dispatch::ready)
+  {
+    for (byte i = 0; i < RFLink::Plugins::runtime::orderCount; i++)
+    {
+      byte x = RFLink::Plugins::runtime::order[i];
+      if (Plugin_State[x] >= P_Enabled && tryRXPlugin(x, frame, inRawSignal))
         return true;
+    }
+    return false;
+  }
+
+  const byte *candidate;
+  const byte *end;
+  int number = frame.Number;
+  uint32_t tried[(PLUGIN_MAX + 31) / 32] = {0};
+
+  lookupCandidates(number, candidate, end);
+  while (candidate < end)
+  {
+    byte x = *candidate++;
+    if (Plugin_State[x] >= P_Enabled && !(tried[x / 32] & (1UL << (x % 32))))
+    {
+      tried[x / 32] |= 1UL << (x % 32);
+      if (tryRXPlugin(x, frame, inRawSignal))
+        return true;
+
+      if (frame.Number != number)
+      {
+        // the plugin has rewritten the signal, the plugins not tried yet are picked for its new pulse count
+        number = frame.Number;
+        lookupCandidates(number, candidate, end);
       }
     }
   }
@@ -2302,7 +2943,7 @@ byte PluginTXCall(byte Function, const char *str)
   {
     if (PluginTX_id[x] != 0)
     {
-      if (PluginTX_ptr[x](Function, str))
+      if (callTXPlugin(x, Function, str))
       {
         return true;
       }
@@ -2310,4 +2951,346 @@ byte PluginTXCall(byte Function, const char *str)
   }
   return false;
 }
-/*********************************************************************************************/
\ No newline at end of file
+/*********************************************************************************************/
+namespace RFLink
+{
+  namespace Plugins
+  {
+    namespace commands
+    {
+      const char order[] PROGMEM = "order";
+      const char reorder[] PROGMEM = "reorder";
+      const char resetHits[] PROGMEM = "resetHits";
+      const char stats[] PROGMEM = "stats";
+      const char resetStats[] PROGMEM = "resetStats";
+    }
+
+    namespace params
+    {
+      bool adaptive_order_enabled = false;
+      unsigned long int adaptive_order_interval = 32;
+    }
+
+    namespace runtime
+    {
+      byte order[PLUGIN_MAX];
+      byte orderCount = 0;
+    }
+
+    namespace counters
+    {
+      unsigned long int hits[PLUGIN_MAX];
+      unsigned long int decodedSinceReorder = 0;
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+      CallStats rxStats[PLUGIN_MAX];
+      CallStats txStats[PLUGIN_TX_MAX];
+#endif
+    }
+
+    // Ordering constraints which hold whatever the hits are, as plugin ids: 'first' is always tried before 'then'.
+    // Plugin 001 is always tried first and plugin 254 always last.
+    struct OrderConstraint
+    {
+      byte first;
+      byte then;
+    };
+
+    const OrderConstraint orderConstraints[] = {
+        {3, 15}, // Kaku swallows the signals marked by Pulses[0] == 15 (Home Easy), before anyone else decodes them
+        {4, 15}, // NewKaku swallows the signals marked by Pulses[0] == 15 (Home Easy), before anyone else decodes them
+    };
+
+    const char json_name_adaptive_order_enabled[] = "adaptive_order_enabled";
+    const char json_name_adaptive_order_interval[] = "adaptive_order_interval";
+
+    Config::ConfigItem configItems[] = {
+            Config::ConfigItem(json_name_adaptive_order_enabled, Config::SectionId::Plugins_id, false, paramsUpdatedCallback),
+            Config::ConfigItem(json_name_adaptive_order_interval, Config::SectionId::Plugins_id, 32, paramsUpdatedCallback),
+
+            Config::ConfigItem()};
+
+    void paramsUpdatedCallback()
+    {
+      refreshParametersFromConfig();
+    }
+
+    void refreshParametersFromConfig(bool triggerChanges)
+    {
+      Config::ConfigItem *item;
+      bool changesDetected = false;
+
+      item = Config::findConfigItem(json_name_adaptive_order_enabled, Config::SectionId::Plugins_id);
+      if (item->getBoolValue() != params::adaptive_order_enabled)
+      {
+        changesDetected = true;
+        params::adaptive_order_enabled = item->getBoolValue();
+      }
+
+      item = Config::findConfigItem(json_name_adaptive_order_interval, Config::SectionId::Plugins_id);
+      if (item->getUnsignedLongIntValue() != params::adaptive_order_interval)
+      {
+        changesDetected = true;
+        params::adaptive_order_interval = item->getUnsignedLongIntValue();
+        if (params::adaptive_order_interval == 0)
+        {
+          Serial.println(F("Invalid adaptive_order_interval provided, resetting to default value"));
+          item->setLongIntValue(item->getLongIntDefaultValue());
+          params::adaptive_order_interval = item->getUnsignedLongIntValue();
+        }
+      }
+
+      if (triggerChanges && changesDetected)
+      {
+        Serial.println(F("Plugins parameters have changed."));
+        updateOrder();
+      }
+    }
+
+    void setup()
+    {
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+        counters::hits[x] = 0;
+      counters::decodedSinceReorder = 0;
+      resetStats();
+
+      refreshParametersFromConfig(false);
+      updateOrder();
+    }
+
+    static byte orderRank(byte x)
+    {
+      if (Plugin_id[x] == 1)
+        return 0;
+      if (Plugin_id[x] == 254)
+        return 2;
+      return 1;
+    }
+
+    static int findInOrder(byte id)
+    {
+      for (byte i = 0; i < runtime::orderCount; i++)
+      {
+        if (Plugin_id[runtime::order[i]] == id)
+          return i;
+      }
+      return -1;
+    }
+
+    static void applyOrderConstraints()
+    {
+      const byte constraintsCount = sizeof(orderConstraints) / sizeof(orderConstraints[0]);
+
+      // moving a plugin may break a constraint already checked, loop until stable (or give up on a cycle)
+      for (byte pass = 0; pass <= constraintsCount; pass++)
+      {
+        bool moved = false;
+
+        for (byte c = 0; c < constraintsCount; c++)
+        {
+          int first = findInOrder(orderConstraints[c].first);
+          int then = findInOrder(orderConstraints[c].then);
+          if (first < 0 || then < 0 || first < then)
+            continue;
+
+          byte x = runtime::order[first];
+          memmove(&runtime::order[then + 1], &runtime::order[then], first - then);
+          runtime::order[then] = x;
+          moved = true;
+        }
+
+        if (!moved)
+          return;
+      }
+    }
+
+    void updateOrder()
+    {
+      runtime::orderCount = 0;
+
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+      {
+        if (Plugin_id[x] == 0)
+          continue;
+
+        // insertion sort, stable so that equal plugins keep their table order
+        byte i = runtime::orderCount++;
+        while (i > 0)
+        {
+          byte previous = runtime::order[i - 1];
+          if (orderRank(previous) < orderRank(x))
+            break;
+          if (orderRank(previous) == orderRank(x) &&
+              (!params::adaptive_order_enabled || counters::hits[previous] >= counters::hits[x]))
+            break;
+          runtime::order[i] = previous;
+          i--;
+        }
+        runtime::order[i] = x;
+      }
+
+      applyOrderConstraints();
+
+      if (!PluginBuildDispatchTable())
+        Serial.println(F("Plugins dispatch table is too small, all plugins will be called for every signal"));
+    }
+
+    void countHit(byte x)
+    {
+      counters::hits[x]++;
+
+      if (++counters::decodedSinceReorder < params::adaptive_order_interval)
+        return;
+      counters::decodedSinceReorder = 0;
+
+      if (params::adaptive_order_enabled)
+        updateOrder();
+
+      // decay, recent signals weigh more than old ones
+      for (byte i = 0; i < PLUGIN_MAX; i++)
+        counters::hits[i] /= 2;
+    }
+
+    static void printOrder()
+    {
+      char dbuffer[16];
+
+      sendRawPrint(PSTR("30;plugins;adaptive_order="));
+      sendRawPrint(params::adaptive_order_enabled ? PSTR("on") : PSTR("off"));
+      sendRawPrint(PSTR(";order="));
+      for (byte i = 0; i < runtime::orderCount; i++)
+      {
+        byte x = runtime::order[i];
+        sprintf_P(dbuffer, PSTR("%s%03u:%lu"), i > 0 ? "," : "", Plugin_id[x], counters::hits[x]);
+        sendRawPrint(dbuffer);
+      }
+      sendRawPrint(PSTR(";"), true);
+    }
+
+    void resetStats()
+    {
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+      memset(counters::rxStats, 0, sizeof(counters::rxStats));
+      memset(counters::txStats, 0, sizeof(counters::txStats));
+#endif
+    }
+
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+    static void printStats(const char *direction, byte id, const CallStats &stats)
+    {
+      char dbuffer[112];
+
+      snprintf_P(dbuffer, sizeof(dbuffer), PSTR("30;plugins;stats;%s;id=%03u;calls=%lu;matches=%lu;time_us=%lu;max_us=%lu;"),
+                 direction, id, stats.calls, stats.matches, stats.time_us, stats.maxTime_us);
+      sendRawPrint(dbuffer, true);
+    }
+#endif
+
+    void executeCliCommand(char *cmd)
+    {
+      char *commaIndex = strchr(cmd, ';');
+
+      if (commaIndex == nullptr)
+      {
+        Serial.println(F("Error : failed to find ending ';' for the command"));
+        return;
+      }
+
+      int commandSize = commaIndex - cmd;
+
+      *commaIndex = 0; // replace ';' with null termination
+
+      if (strncasecmp_P(cmd, commands::order, commandSize) == 0)
+      {
+        printOrder();
+      }
+      else if (strncasecmp_P(cmd, commands::reorder, commandSize) == 0)
+      {
+        if (!params::adaptive_order_enabled)
+        {
+          Serial.println(F("Error : adaptive ordering is disabled"));
+          return;
+        }
+        counters::decodedSinceReorder = 0;
+        updateOrder();
+        printOrder();
+      }
+      else if (strncasecmp_P(cmd, commands::resetHits, commandSize) == 0)
+      {
+        for (byte x = 0; x < PLUGIN_MAX; x++)
+          counters::hits[x] = 0;
+        counters::decodedSinceReorder = 0;
+        updateOrder();
+        printOrder();
+      }
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+      else if (strncasecmp_P(cmd, commands::stats, commandSize) == 0)
+      {
+        // only the plugins which have been called, sorted as in the plugin tables
+        for (byte x = 0; x < PLUGIN_MAX; x++)
+        {
+          if (Plugin_id[x] != 0 && counters::rxStats[x].calls > 0)
+            printStats("rx", Plugin_id[x], counters::rxStats[x]);
+        }
+        for (byte x = 0; x < PLUGIN_TX_MAX; x++)
+        {
+          if (PluginTX_id[x] != 0 && counters::txStats[x].calls > 0)
+            printStats("tx", PluginTX_id[x], counters::txStats[x]);
+        }
+        sendRawPrint(PSTR("30;plugins;stats;end;"), true);
+      }
+      else if (strncasecmp_P(cmd, commands::resetStats, commandSize) == 0)
+      {
+        resetStats();
+        sendRawPrint(PSTR("30;plugins;stats;reset;"), true);
+      }
+#endif
+      else
+      {
+        Serial.printf_P(PSTR("Error : unknown command '%s'\r\n"), cmd);
+      }
+    }
+
+    void getStatusJsonString(JsonObject &output)
+    {
+      auto &&plugins = output.createNestedObject("plugins");
+      plugins[F("adaptive_order_enabled")] = params::adaptive_order_enabled;
+
+      auto &&order = plugins.createNestedArray(F("order"));
+      auto &&hits = plugins.createNestedArray(F("hits"));
+      for (byte i = 0; i < runtime::orderCount; i++)
+      {
+        order.add(Plugin_id[runtime::order[i]]);
+        hits.add(counters::hits[runtime::order[i]]);
+      }
+
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+      // [id, calls, matches, time_us, max_us] of the plugins which have been called
+      auto &&rxStats = plugins.createNestedArray(F("rx_stats"));
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+      {
+        if (Plugin_id[x] == 0 || counters::rxStats[x].calls == 0)
+          continue;
+        auto &&entry = rxStats.createNestedArray();
+        entry.add(Plugin_id[x]);
+        entry.add(counters::rxStats[x].calls);
+        entry.add(counters::rxStats[x].matches);
+        entry.add(counters::rxStats[x].time_us);
+        entry.add(counters::rxStats[x].maxTime_us);
+      }
+
+      auto &&txStats = plugins.createNestedArray(F("tx_stats"));
+      for (byte x = 0; x < PLUGIN_TX_MAX; x++)
+      {
+        if (PluginTX_id[x] == 0 || counters::txStats[x].calls == 0)
+          continue;
+        auto &&entry = txStats.createNestedArray();
+        entry.add(PluginTX_id[x]);
+        entry.add(counters::txStats[x].calls);
+        entry.add(counters::txStats[x].matches);
+        entry.add(counters::txStats[x].time_us);
+        entry.add(counters::txStats[x].maxTime_us);
+      }
+#endif
+    }
+  }
+}
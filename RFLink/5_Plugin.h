@@ -9,6 +9,15 @@
 #define Plugin_h
 
 #include <Arduino.h>
+#include "11_Config.h"
+
+namespace RFLink
+{
+    namespace Signal
+    {
+        struct PulseSpan;
+    }
+}
 
 #define PLUGIN_MAX 84    // Maximum number of Receive plugins
 #define PLUGIN_TX_MAX 84 // Maximum number of Transmit plugins
@@ -21,9 +30,34 @@ enum PState
     P_Mandatory
 };
 
+// Pulse counts (RawSignal.Number) a receive plugin may decode, bounds included.
+// Each plugin declares its ranges with PLUGIN_PULSES_xxx next to PLUGIN_DESC_xxx, for instance
+//   #define PLUGIN_PULSES_004 {132, 132}, {148, 148}
+// PluginRXCall() only calls the plugins whose ranges hold the pulse count of the received frame.
+struct PluginPulsesRange
+{
+    uint16_t min;
+    uint16_t max;
+};
+
+#define PLUGIN_PULSES_MAX 0xFFFF
+#define PLUGIN_PULSES_ANY {1, PLUGIN_PULSES_MAX}
+
+#ifndef PLUGIN_DISPATCH_SEGMENTS_MAX
+#define PLUGIN_DISPATCH_SEGMENTS_MAX 192    // Maximum number of distinct pulse count segments
+#endif
+#ifndef PLUGIN_DISPATCH_CANDIDATES_MAX
+#define PLUGIN_DISPATCH_CANDIDATES_MAX 1024 // Maximum number of plugin entries over all segments
+#endif
+
 extern boolean (*Plugin_ptr[PLUGIN_MAX])(byte, const char *); // Receive plugins
+// Receive plugins reading their frame from a PulseSpan, nullptr for those only reading RawSignal.
+// Such a plugin keeps a Plugin_ptr entry as well, which decodes RawSignal through its PulseSpan version.
+extern boolean (*PluginSpan_ptr[PLUGIN_MAX])(const RFLink::Signal::PulseSpan &);
 extern byte Plugin_id[PLUGIN_MAX];
 extern byte Plugin_State[PLUGIN_MAX];
+extern const PluginPulsesRange *Plugin_PulsesRanges[PLUGIN_MAX];
+extern byte Plugin_PulsesRangesCount[PLUGIN_MAX];
 #ifndef ARDUINO_AVR_UNO // Optimize memory limit to 2048 bytes on arduino uno
 extern const char* Plugin_Description[PLUGIN_MAX];
 #endif
@@ -42,7 +76,63 @@ void PluginInit();
 void PluginTXInit();
 byte PluginInitCall(byte Function, char *str);
 byte PluginTXInitCall(byte Function, char *str);
-byte PluginRXCall(byte Function, const char *str);
+byte PluginRXCall(byte Function, const char *str); // decodes RawSignal
+// Decodes any frame. It is only copied into RawSignal if a plugin without a PluginSpan_ptr entry has to be tried.
+byte PluginRXCall(const RFLink::Signal::PulseSpan &frame);
+bool PluginBuildDispatchTable();
 byte PluginTXCall(byte Function, const char *str);
 
+namespace RFLink
+{
+    namespace Plugins
+    {
+        namespace params
+        {
+            extern bool adaptive_order_enabled;
+            extern unsigned long int adaptive_order_interval; // decoded signals between two reorderings
+        }
+
+        namespace runtime
+        {
+            extern byte order[PLUGIN_MAX]; // plugin table indexes in the order they are tried
+            extern byte orderCount;
+        }
+
+        struct CallStats
+        {
+            unsigned long int calls;
+            unsigned long int matches;  // calls which returned true
+            unsigned long int time_us;  // cumulated time spent in the plugin
+            unsigned long int maxTime_us;
+        };
+
+        namespace counters
+        {
+            extern unsigned long int hits[PLUGIN_MAX]; // signals decoded by each plugin, halved at every reordering
+            extern unsigned long int decodedSinceReorder;
+#ifndef RFLINK_PLUGINS_STATS_DISABLED
+            extern CallStats rxStats[PLUGIN_MAX];    // indexed like Plugin_ptr
+            extern CallStats txStats[PLUGIN_TX_MAX]; // indexed like PluginTX_ptr
+#endif
+        }
+
+        extern Config::ConfigItem configItems[];
+
+        void setup();
+        void paramsUpdatedCallback();
+        void refreshParametersFromConfig(bool triggerChanges = true);
+
+        /**
+         * Sorts the plugins by hits when adaptive ordering is enabled (table order otherwise),
+         * then applies the ordering constraints and rebuilds the dispatch table
+         * */
+        void updateOrder();
+        void countHit(byte x);
+        void resetStats();
+
+        void executeCliCommand(char *cmd);
+        void getStatusJsonString(JsonObject &output);
+    }
+}
+
 #endif
\ No newline at end of file
@@ -378,7 +378,9 @@ inline bool value_between(uint32_t value, uint32_t min, uint32_t max)
     return (value > min && value < max);
 }
 
-bool decode_pwm(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint16_t shortPulseMinDuration, uint16_t shortPulseMaxDuration, uint16_t longPulseMinDuration, uint16_t longPulseMaxDuration)
+// Templated on the pulses storage so that the compact one is read without being expanded first
+template <typename PulsesT>
+static bool decodePwmPulses(uint8_t frame[], uint8_t expectedBitCount, const PulsesT &pulses, const int pulsesCount, int pulseIndex, uint16_t shortPulseMinDuration, uint16_t shortPulseMaxDuration, uint16_t longPulseMinDuration, uint16_t longPulseMaxDuration)
 {
     if (pulseIndex + expectedBitCount * 2 > pulsesCount)
     {
@@ -432,7 +434,8 @@ bool decode_pwm(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses
     return true;
 }
 
-bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfBitMinDuration, uint16_t halfBitMaxDuration)
+template <typename PulsesT>
+static bool decodeManchesterPulses(uint8_t frame[], uint8_t expectedBitCount, const PulsesT &pulses, const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfBitMinDuration, uint16_t halfBitMaxDuration)
 {
     int bitIndex = 0;
     const uint8_t bitsPerByte = 8;
@@ -502,6 +505,26 @@ bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, uint16_t const
     return (bitIndex == expectedBitCount);
 }
 
+bool decode_pwm(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint16_t shortPulseMinDuration, uint16_t shortPulseMaxDuration, uint16_t longPulseMinDuration, uint16_t longPulseMaxDuration)
+{
+    return decodePwmPulses(frame, expectedBitCount, pulses, pulsesCount, pulseIndex, shortPulseMinDuration, shortPulseMaxDuration, longPulseMinDuration, longPulseMaxDuration);
+}
+
+bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfBitMinDuration, uint16_t halfBitMaxDuration)
+{
+    return decodeManchesterPulses(frame, expectedBitCount, pulses, pulsesCount, pulseIndex, nextBit, secondPulse, halfBitMinDuration, halfBitMaxDuration);
+}
+
+bool decode_pwm(uint8_t frame[], uint8_t expectedBitCount, RFLink::Signal::CompactPulsesView pulses, const int pulsesCount, int pulseIndex, uint16_t shortPulseMinDuration, uint16_t shortPulseMaxDuration, uint16_t longPulseMinDuration, uint16_t longPulseMaxDuration)
+{
+    return decodePwmPulses(frame, expectedBitCount, pulses, pulsesCount, pulseIndex, shortPulseMinDuration, shortPulseMaxDuration, longPulseMinDuration, longPulseMaxDuration);
+}
+
+bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, RFLink::Signal::CompactPulsesView pulses, const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfBitMinDuration, uint16_t halfBitMaxDuration)
+{
+    return decodeManchesterPulses(frame, expectedBitCount, pulses, pulsesCount, pulseIndex, nextBit, secondPulse, halfBitMinDuration, halfBitMaxDuration);
+}
+
 namespace RFLink {
   namespace Utils {
 
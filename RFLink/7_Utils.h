@@ -30,6 +30,7 @@
 #define INCLUDE_UTIL_H_
 
 #include <stdint.h>
+#include "16_PulseStorage.h"
 
 // Helper macros, collides with MSVC's stdlib.h unless NOMINMAX is used
 #ifndef MAX
@@ -326,6 +327,10 @@ bool decode_pwm(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses
 */
 bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfBitMinDuration, uint16_t halfBitMaxDuration);
 
+/// Same as above on RawSignal.Pulses stored one byte per pulse (RFLINK_SIGNAL_COMPACT_PULSES)
+bool decode_pwm(uint8_t frame[], uint8_t expectedBitCount, RFLink::Signal::CompactPulsesView pulses, const int pulsesCount, int pulseIndex, uint16_t shortPulseMinDuration, uint16_t shortPulseMaxDuration, uint16_t longPulseMinDuration, uint16_t longPulseMaxDuration);
+bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, RFLink::Signal::CompactPulsesView pulses, const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfBitMinDuration, uint16_t halfBitMaxDuration);
+
 
 
 namespace RFLink {
@@ -361,6 +366,23 @@ namespace RFLink {
 
       }
 
+      inline bool fillFromPwmPulses(uint8_t expectedBitCount,
+                                    RFLink::Signal::CompactPulsesView pulses,
+                                    const int pulsesCount,
+                                    int pulseIndex,
+                                    uint16_t shortPulseMinDuration,
+                                    uint16_t shortPulseMaxDuration,
+                                    uint16_t longPulseMinDuration,
+                                    uint16_t longPulseMaxDuration) {
+
+        return decode_pwm(this->storage, expectedBitCount,
+                          pulses, pulsesCount,
+                          pulseIndex,
+                          shortPulseMinDuration, shortPulseMaxDuration,
+                          longPulseMinDuration, longPulseMaxDuration);
+
+      }
+
       inline bool getBit(const uint16_t bitNumber) {
         return (storage[bitNumber / 8] & (0x80 >> (bitNumber%8))) != 0;
       }
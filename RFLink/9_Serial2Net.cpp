@@ -1,5 +1,6 @@
 #include "9_Serial2Net.h"
 #include "RFLink.h"
+#include "2_Signal.h"
 
 #ifndef RFLINK_SERIAL2NET_DISABLED
 
@@ -206,19 +207,26 @@ namespace RFLink {
       WiFiClient newClient = server.available();
 
       if (newClient.connected()) {
-        if (isNewClient(newClient)) {
+        // the decode task broadcasts its messages to the clients, they must not change meanwhile
+        Signal::AsyncSignalScanner::lockDecoder();
+        bool isNew = isNewClient(newClient);
+        if (isNew) {
 #if defined(RFLINK_SERIAL2NET_DEBUG) || defined(DEBUG)
           Serial.printf(PSTR("Serial2Net: new client detected IP=%s port=%i\r\n"), newClient.remoteIP().toString().c_str(), newClient.remotePort());
 #endif
           registerClient(newClient);
-          return;
         }
+        Signal::AsyncSignalScanner::unlockDecoder();
+        if (isNew)
+          return;
       }
 
       // Let's see if any client has sent some data
       for (auto & client : clients) {
         if (!client.ignore) {
+          // read without the lock, a partial command waits for the client timeout
           if (client.hasCommandAvailable()) {
+            Signal::AsyncSignalScanner::lockDecoder(); // the echo and the command output are not mixed with decoded frames
             RFLink::sendRawPrint(F("\33[2K\r"));
             //Serial.flush();
             RFLink::sendRawPrint(F("Message arrived [Ser2Net]:"));
@@ -227,6 +235,7 @@ namespace RFLink {
             //Serial.flush();
             RFLink::executeCliCommand(client.buffer);
             client.consumeCommand();
+            Signal::AsyncSignalScanner::unlockDecoder();
           }
         }
       }
@@ -256,8 +265,17 @@ namespace RFLink {
       }
     }
 
+    void broadcastMessage(const char *buf, size_t length) {
+      for (auto & client : clients) {
+        if (!client.ignore && client.connected()) {
+          client.write((const uint8_t *)buf, length);
+        }
+      }
+    }
+
 
     void restartServer() {
+      Signal::AsyncSignalScanner::lockDecoder();
       for (auto & client : clients) {
         if (!client.ignore && client.connected()) {
           client.printf(PSTR("\nSerial2Net will restart on port %u\r\n"), params::port);
@@ -265,6 +283,7 @@ namespace RFLink {
       }
       stopServer(false);
       startServer();
+      Signal::AsyncSignalScanner::unlockDecoder();
     }
 
     void startServer() {
@@ -273,6 +292,7 @@ namespace RFLink {
     }
 
     void stopServer(bool show_message) {
+      Signal::AsyncSignalScanner::lockDecoder(); // the decode task may be writing to the clients
       for (auto & client : clients) {
         if (!client.ignore && client.connected()) {
           if (show_message) {
@@ -281,6 +301,7 @@ namespace RFLink {
           client.disconnectAndClear();
         }
       }
+      Signal::AsyncSignalScanner::unlockDecoder();
       server.stop();
       if (show_message)
         Serial.println(F("Serial2Net Server stopped!"));
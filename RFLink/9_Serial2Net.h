@@ -37,6 +37,7 @@ namespace RFLink {
         void broadcastMessage(const char *msg);
         void broadcastMessage(const __FlashStringHelper *buf);
         void broadcastMessage(char c);
+        void broadcastMessage(const char *buf, size_t length);
 
         void paramsUpdatedCallback();
         void refreshParametersFromConfig(bool triggerChanges=true);
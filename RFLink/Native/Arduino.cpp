@@ -0,0 +1,173 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host implementation of the Arduino core shims declared in Arduino.h and FS.h (env:native only)
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+HardwareSerial Serial;
+fs::FS LittleFS;
+
+static unsigned long long monotonicTime_us()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static const unsigned long long bootTime_us = monotonicTime_us();
+
+unsigned long millis()
+{
+  return (unsigned long)((monotonicTime_us() - bootTime_us) / 1000);
+}
+
+unsigned long micros()
+{
+  return (unsigned long)(monotonicTime_us() - bootTime_us);
+}
+
+void delay(unsigned long ms)
+{
+  usleep(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  unsigned long long end = monotonicTime_us() + us;
+  while (monotonicTime_us() < end)
+    ;
+}
+
+void yield() {}
+
+// there is no receiver attached to a PC, pins are always LOW
+int digitalRead(uint8_t pin) { return LOW; }
+void digitalWrite(uint8_t pin, uint8_t val) {}
+void pinMode(uint8_t pin, uint8_t mode) {}
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode) {}
+void detachInterrupt(uint8_t pin) {}
+
+static char *unsignedToString(unsigned long value, char *str, int base, bool negative)
+{
+  char digits[sizeof(unsigned long) * 8 + 1];
+  int length = 0;
+
+  if (base < 2 || base > 36)
+  {
+    str[0] = 0;
+    return str;
+  }
+
+  do
+  {
+    int digit = value % base;
+    digits[length++] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+    value /= base;
+  } while (value > 0);
+
+  char *out = str;
+  if (negative)
+    *out++ = '-';
+  while (length > 0)
+    *out++ = digits[--length];
+  *out = 0;
+
+  return str;
+}
+
+char *ltoa(long value, char *str, int base)
+{
+  if (value < 0 && base == 10)
+    return unsignedToString(-(unsigned long)value, str, base, true);
+  return unsignedToString((unsigned long)value, str, base, false);
+}
+
+char *itoa(int value, char *str, int base)
+{
+  if (value < 0 && base == 10)
+    return unsignedToString(-(unsigned long)value, str, base, true);
+  return unsignedToString((unsigned int)value, str, base, false);
+}
+
+char *utoa(unsigned int value, char *str, int base)
+{
+  return unsignedToString(value, str, base, false);
+}
+
+char *ultoa(unsigned long value, char *str, int base)
+{
+  return unsignedToString(value, str, base, false);
+}
+
+size_t HardwareSerial::printNumber(unsigned long n, int base, bool negative)
+{
+  char buf[sizeof(unsigned long) * 8 + 2];
+  return print(unsignedToString(n, buf, base, negative));
+}
+
+size_t File::size()
+{
+  if (handle == nullptr)
+    return 0;
+  long current = ftell(handle);
+  fseek(handle, 0, SEEK_END);
+  long end = ftell(handle);
+  fseek(handle, current, SEEK_SET);
+  return end;
+}
+
+namespace fs
+{
+  std::string FS::hostPath(const char *path)
+  {
+    static std::string defaultRoot;
+    const char *root = getenv("RFLINK_NATIVE_FS_DIR");
+    if (root == nullptr)
+    {
+      // not the current directory, which is the repository when the CLI is run as documented
+      if (defaultRoot.empty())
+      {
+        const char *tmp = getenv("TMPDIR");
+        defaultRoot = std::string(tmp != nullptr ? tmp : "/tmp") + "/rflink_native_fs";
+        mkdir(defaultRoot.c_str(), 0755);
+      }
+      root = defaultRoot.c_str();
+    }
+    std::string result(root);
+    if (path[0] != '/')
+      result += '/';
+    return result + path;
+  }
+
+  bool FS::exists(const char *path)
+  {
+    return access(hostPath(path).c_str(), F_OK) == 0;
+  }
+
+  File FS::open(const char *path, const char *mode, bool create)
+  {
+    std::string fileMode(mode);
+    if (fileMode.find('b') == std::string::npos)
+      fileMode += 'b';
+    return File(fopen(hostPath(path).c_str(), fileMode.c_str()));
+  }
+
+  bool FS::remove(const char *path)
+  {
+    return ::remove(hostPath(path).c_str()) == 0;
+  }
+
+  bool FS::rename(const char *from, const char *to)
+  {
+    return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+  }
+}
@@ -0,0 +1,223 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Thin Arduino core replacement used by the host-native (env:native) build only.
+// It provides just enough of the Arduino/ESP API for 2_Signal, 5_Plugin, 4_Display and 7_Utils.
+
+#ifndef Native_Arduino_h
+#define Native_Arduino_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <string>
+
+#include "binary.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define CHANGE 0x03
+#define RISING 0x01
+#define FALLING 0x02
+#define NOT_A_PIN -1
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define FPSTR(p) ((const __FlashStringHelper *)(p))
+#define F(s) ((const __FlashStringHelper *)(s))
+class __FlashStringHelper;
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+#define strncasecmp_P strncasecmp
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strstr_P strstr
+#define memcpy_P memcpy
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define bit(b) (1UL << (b))
+#define lowByte(w) ((uint8_t)((w)&0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+
+#ifndef __cplusplus
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#else
+#include <algorithm>
+using std::max;
+using std::min;
+#endif
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+char *itoa(int value, char *str, int base);
+char *ltoa(long value, char *str, int base);
+char *utoa(unsigned int value, char *str, int base);
+char *ultoa(unsigned long value, char *str, int base);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+void pinMode(uint8_t pin, uint8_t mode);
+#define digitalPinToInterrupt(p) (p)
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void detachInterrupt(uint8_t pin);
+#define noInterrupts()
+#define interrupts()
+
+class String : public std::string
+{
+public:
+  String() {}
+  String(const char *s) : std::string(s ? s : "") {}
+  String(const std::string &s) : std::string(s) {}
+  String(const __FlashStringHelper *s) : std::string((const char *)s) {}
+  String(long n) : std::string(std::to_string(n)) {}
+  String(unsigned long n) : std::string(std::to_string(n)) {}
+  String(int n) : std::string(std::to_string(n)) {}
+  String(unsigned int n) : std::string(std::to_string(n)) {}
+  String(char c) : std::string(1, c) {}
+  String(float f, unsigned char decimals = 2)
+  {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, f);
+    assign(buf);
+  }
+  unsigned int length() const { return (unsigned int)size(); }
+  void trim()
+  {
+    size_t first = find_first_not_of(" \t\r\n");
+    size_t last = find_last_not_of(" \t\r\n");
+    if (first == npos)
+      clear();
+    else
+      assign(substr(first, last - first + 1));
+  }
+  void toCharArray(char *buf, unsigned int bufsize) const
+  {
+    if (bufsize == 0)
+      return;
+    strncpy(buf, c_str(), bufsize - 1);
+    buf[bufsize - 1] = 0;
+  }
+  int indexOf(char c) const
+  {
+    size_t pos = find(c);
+    return pos == npos ? -1 : (int)pos;
+  }
+  long toInt() const { return atol(c_str()); }
+  String &operator+=(const char *s)
+  {
+    append(s ? s : "");
+    return *this;
+  }
+  String &operator+=(const String &s)
+  {
+    append(s);
+    return *this;
+  }
+  String &operator+=(char c)
+  {
+    push_back(c);
+    return *this;
+  }
+  String &operator+=(const __FlashStringHelper *s) { return *this += (const char *)s; }
+};
+
+class HardwareSerial
+{
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+  size_t write(const uint8_t *buf, size_t len) { return fwrite(buf, 1, len, stdout); }
+  size_t write(const char *buf, size_t len) { return fwrite(buf, 1, len, stdout); }
+  size_t print(const char *s) { return fputs(s, stdout) >= 0 ? strlen(s) : 0; }
+  size_t print(const __FlashStringHelper *s) { return print((const char *)s); }
+  size_t print(const String &s) { return print(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(long n, int base = DEC) { return printNumber(n < 0 ? -(unsigned long)n : n, base, n < 0); }
+  size_t print(unsigned long n, int base = DEC) { return printNumber(n, base, false); }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(double f, int digits = 2) { return printf("%.*f", digits, f); }
+  size_t println() { return print("\r\n"); }
+  template <typename T>
+  size_t println(T v)
+  {
+    size_t n = print(v);
+    return n + println();
+  }
+  template <typename T>
+  size_t println(T v, int format)
+  {
+    size_t n = print(v, format);
+    return n + println();
+  }
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n < 0 ? 0 : n;
+  }
+  size_t printf_P(const char *format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n < 0 ? 0 : n;
+  }
+  int available() { return 0; }
+  int read() { return -1; }
+  void flush() { fflush(stdout); }
+
+private:
+  size_t printNumber(unsigned long n, int base, bool negative);
+};
+
+extern HardwareSerial Serial;
+
+#endif // Native_Arduino_h
@@ -0,0 +1,77 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Minimal FS API on top of stdio for the host-native (env:native) build only.
+// Paths are mapped below the directory given by RFLINK_NATIVE_FS_DIR (default: $TMPDIR/rflink_native_fs, /tmp/rflink_native_fs without TMPDIR).
+
+#ifndef Native_FS_h
+#define Native_FS_h
+
+#include <Arduino.h>
+
+enum SeekMode
+{
+  SeekSet = SEEK_SET,
+  SeekCur = SEEK_CUR,
+  SeekEnd = SEEK_END
+};
+
+class File
+{
+public:
+  File(FILE *handle = nullptr) : handle(handle) {}
+
+  operator bool() const { return handle != nullptr; }
+  size_t read(uint8_t *buf, size_t size) { return handle ? fread(buf, 1, size, handle) : 0; }
+  int read()
+  {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  size_t write(const uint8_t *buf, size_t size) { return handle ? fwrite(buf, 1, size, handle) : 0; }
+  size_t write(uint8_t c) { return write(&c, 1); }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet) { return handle && fseek(handle, pos, mode) == 0; }
+  size_t position() { return handle ? ftell(handle) : 0; }
+  size_t size();
+  int available() { return handle ? (int)(size() - position()) : 0; }
+  void flush()
+  {
+    if (handle)
+      fflush(handle);
+  }
+  void close()
+  {
+    if (handle)
+      fclose(handle);
+    handle = nullptr;
+  }
+
+private:
+  FILE *handle;
+};
+
+namespace fs
+{
+  class FS
+  {
+  public:
+    bool begin(bool formatOnFail = false) { return true; }
+    bool exists(const char *path);
+    bool exists(const __FlashStringHelper *path) { return exists((const char *)path); }
+    File open(const char *path, const char *mode, bool create = false);
+    File open(const __FlashStringHelper *path, const char *mode, bool create = false) { return open((const char *)path, mode, create); }
+    bool remove(const char *path);
+    bool remove(const __FlashStringHelper *path) { return remove((const char *)path); }
+    bool rename(const char *from, const char *to);
+
+  private:
+    std::string hostPath(const char *path);
+  };
+}
+
+using fs::FS;
+
+#endif // Native_FS_h
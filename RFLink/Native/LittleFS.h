@@ -0,0 +1,16 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host-native (env:native) build only, see FS.h
+
+#ifndef Native_LittleFS_h
+#define Native_LittleFS_h
+
+#include "FS.h"
+
+extern fs::FS LittleFS;
+
+#endif // Native_LittleFS_h
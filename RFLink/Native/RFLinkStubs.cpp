@@ -0,0 +1,191 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host (env:native) replacements for the parts of RFLink core, Radio and Config
+// the decoding pipeline depends on. Output goes to stdout, config always holds default values.
+
+#include <Arduino.h>
+#include "../RFLink.h"
+#include "../1_Radio.h"
+#include "../2_Signal.h"
+#include "../3_Serial.h"
+#include "../4_Display.h"
+#include "../5_Plugin.h"
+#include "../11_Config.h"
+
+char InputBuffer_Serial[INPUT_COMMAND_SIZE];
+
+namespace RFLink
+{
+  char printBuf[300];
+
+  void sendMsgFromBuffer()
+  {
+    if (pbuffer[0] != 0)
+    {
+      Serial.print(pbuffer);
+      pbuffer[0] = 0;
+    }
+  }
+
+  void sendRawPrint(const char *buf, bool end_of_line)
+  {
+    LineWriter line;
+    line.print(buf);
+    if (end_of_line)
+      line.println();
+  }
+
+  void sendRawPrint(const __FlashStringHelper *buf, bool end_of_line)
+  {
+    sendRawPrint((const char *)buf, end_of_line);
+  }
+
+  void sendRawPrint(long n) { LineWriter().print(n); }
+  void sendRawPrint(unsigned long n) { LineWriter().print(n); }
+  void sendRawPrint(int n) { LineWriter().print(n); }
+  void sendRawPrint(unsigned int n) { LineWriter().print(n); }
+  void sendRawPrint(float f) { LineWriter().print(f); }
+  void sendRawPrint(char c) { LineWriter().print(c); }
+  void sendRawData(const char *buf, size_t length) { Serial.write(buf, length); }
+
+  namespace Radio
+  {
+    States current_State = States::Radio_RX;
+    HardwareType hardware = HardwareType::HW_basic_t;
+    bool hardwareProperlyInitialized = true;
+
+    namespace pins
+    {
+      int8_t RX_DATA = NOT_A_PIN;
+      int8_t TX_DATA = NOT_A_PIN;
+    }
+
+    float getCurrentRssi()
+    {
+      return -120.0F;
+    }
+
+    int32_t getFrequency()
+    {
+      return 433920000;
+    }
+
+    int32_t setFrequency(int32_t newFrequency)
+    {
+      return 0;
+    }
+
+    void set_Radio_mode(States new_state, bool force)
+    {
+      current_State = new_state;
+    }
+  }
+
+  namespace Config
+  {
+    static const char *jsonSections[] = {"wifi", "ota", "core", "mqtt", "portal", "signal", "radio", "serial2net", "plugins", "root"};
+
+    static ConfigItem *configItemLists[] = {
+        &Signal::configItems[0],
+        &Plugins::configItems[0],
+    };
+
+    static DynamicJsonDocument doc(4096);
+
+    void setup()
+    {
+      JsonObject root = doc.to<JsonObject>();
+
+      for (unsigned int i = 0; i < sizeof(configItemLists) / sizeof(ConfigItem *); i++)
+      {
+        for (ConfigItem *item = configItemLists[i]; !item->typeIsEOF(); item++)
+        {
+          JsonObject section = root[jsonSections[item->section]];
+          if (section.isNull())
+            section = root.createNestedObject(jsonSections[item->section]);
+          item->createInJsonObject(section);
+        }
+      }
+    }
+
+    ConfigItem::ConfigItem(const char *name, SectionId section, const char *default_value, void (*update_callback)(), bool can_be_null)
+    {
+      this->json_name = name;
+      this->section = section;
+      this->type = ConfigItemType::STRING_t;
+      this->update_callback = update_callback;
+      this->canBeNull = can_be_null;
+      this->defaultValue = (void *)default_value;
+    }
+
+    ConfigItem::ConfigItem(const char *name, SectionId section, long int default_value, void (*update_callback)(), bool can_be_null)
+    {
+      this->json_name = name;
+      this->section = section;
+      this->type = ConfigItemType::LONG_INT_t;
+      this->update_callback = update_callback;
+      this->canBeNull = can_be_null;
+      this->defaultValue = (void *)default_value;
+    }
+
+    ConfigItem::ConfigItem(const char *name, SectionId section, bool default_value, void (*update_callback)(), bool can_be_null)
+    {
+      this->json_name = name;
+      this->section = section;
+      this->type = ConfigItemType::BOOLEAN_t;
+      this->update_callback = update_callback;
+      this->canBeNull = can_be_null;
+      this->boolDefaultValue = default_value;
+    }
+
+    ConfigItem::ConfigItem()
+    {
+      this->json_name = nullptr;
+      this->section = SectionId::EOF_id;
+      this->type = ConfigItemType::EOF_t;
+      this->update_callback = nullptr;
+      this->canBeNull = false;
+    }
+
+    JsonVariant ConfigItem::createInJsonObject(JsonObject &obj)
+    {
+      if (this->typeIsChar())
+        obj[this->json_name] = this->getCharDefaultValue();
+      else if (this->typeIsLongInt())
+        obj[this->json_name] = this->getLongIntDefaultValue();
+      else if (this->typeIsBool())
+        obj[this->json_name] = this->getBoolDefaultValue();
+      else
+        return JsonVariant();
+
+      this->jsonRef = obj[this->json_name];
+      return this->jsonRef;
+    }
+
+    ConfigItem *findConfigItem(const char *name, SectionId section)
+    {
+      for (unsigned int i = 0; i < sizeof(configItemLists) / sizeof(ConfigItem *); i++)
+      {
+        ConfigItem *item = configItemLists[i];
+
+        while (!item->typeIsEOF())
+        {
+          if (item->section == section && strcmp(item->json_name, name) == 0)
+            return item;
+          item++;
+        }
+      }
+
+      return nullptr;
+    }
+
+    bool saveConfigToFlash()
+    {
+      return true;
+    }
+  }
+}
@@ -0,0 +1,840 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Pulse replay decoder for the host-native build (pio run -e native).
+//
+// Reads captured frames, one per line, from files or stdin:
+//   20;XX;DEBUG;Pulses=24;Pulses(uSec)=325,800,275,800,...;
+//   {"pulses":[325,800,275,800,...]}    (or any line ending with the JSON of a sendRF/testRF command)
+// loads them into RawSignal, runs PluginRXCall(0,0) and prints what the plugins have put in pbuffer.
+//
+// With --trace, inputs are edge traces (see ReplayPulseSource in 14_PulseSource.h) which are
+// first cut into frames by the applied slicer.
+//
+// With --bench, frames are loaded in memory and every enabled plugin is timed against every frame:
+// ns per call on frames it decodes, ns per call on frames it rejects, and the full PluginRXCall cost
+// per frame. The frame features (19_FrameFeatures.h), computed once per frame and shared by the plugins,
+// are timed on their own line and left out of the plugin times, PluginRXCall only computes them when a
+// plugin asks for them. tools/corpus/ holds a corpus extracted from the plugin header comments for this purpose.
+//
+// With --jitter, synthetic frames are replayed through the RSSI_Advanced slicer to measure how far
+// the pulses it stores are from the sent ones, depending on how often it reads the RSSI.
+//
+// With --capture, every frame is also written to a file in the format of the capture stream
+// (see 18_CaptureStream.h), which tools/capture_decoder.py reads back.
+
+#include <Arduino.h>
+#include <getopt.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <vector>
+#include <algorithm>
+#include "../RFLink.h"
+#include "../2_Signal.h"
+#include "../4_Display.h"
+#include "../5_Plugin.h"
+#include "../11_Config.h"
+#include "../14_PulseSource.h"
+#include "../15_DedupCache.h"
+#include "../18_CaptureStream.h"
+#include "../19_FrameFeatures.h"
+
+using namespace RFLink;
+using namespace RFLink::Signal;
+
+namespace Replay
+{
+  namespace params
+  {
+    bool quiet = false;
+    bool showFrames = false;
+    bool keepRepeatFilter = false;
+    bool traceInput = false;
+    bool bench = false;
+    bool voteRepeats = false;
+    bool realign = false;
+    bool noiseGate = false;
+    bool jitter = false;
+    unsigned int loops = 1;
+    unsigned int pollCost_us = 1;
+    unsigned int rssiCost_us = 30;
+    FILE *captureFile = nullptr;
+  }
+
+  namespace counters
+  {
+    unsigned long long frames = 0;
+    unsigned long long decodedFrames = 0;
+    unsigned long long invalidLines = 0;
+    unsigned long long gatedFrames = 0;
+    unsigned long long decodeTime_ns = 0;
+    unsigned long long replayedTime_us = 0;
+  }
+
+  unsigned long long monotonicTime_ns()
+  {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+  }
+
+  void resetRepeatFilter()
+  {
+    SignalCRC = 0L;
+    SignalCRC_1 = 0L;
+    SignalHashPrevious = 0L;
+    RepeatingTimer = 0L;
+    DedupCache::reset();
+  }
+
+  /**
+   * Appends the frame currently in RawSignal to the --capture file
+   * */
+  void captureFrame()
+  {
+    static uint8_t frame[CAPTURE_FRAME_MAX_SIZE];
+    static uint16_t sequence = 0;
+    CaptureStream::LinearSink sink = {frame, sizeof(frame), 0};
+
+    CaptureStream::encodeFrame(PulseSpan(RawSignal), RawSignal.endReason, sequence++, sink);
+    if (sink.overflowed() || fwrite(frame, 1, sink.length, params::captureFile) != sink.length)
+      fprintf(stderr, "cannot write frame %u to the capture file\n", sequence - 1);
+  }
+
+  /**
+   * Decodes the frame currently in RawSignal, like ScanEvent() does
+   * */
+  bool decodeRawSignal()
+  {
+    static PulseCode pulsesBackup[RAW_BUFFER_SIZE + 1];
+    const int number = RawSignal.Number;
+    bool decoded = false;
+    bool gated = false;
+
+    if (params::showFrames)
+      displaySignal(RawSignal);
+    if (params::captureFile != nullptr)
+      captureFrame();
+
+    if (params::loops > 1) // plugins may modify the frame, each loop must see the original one
+      memcpy(pulsesBackup, PULSES_STORAGE(RawSignal.Pulses), sizeof(PulseCode) * (number + 2));
+
+    for (unsigned int loop = 0; loop < params::loops; loop++)
+    {
+      if (loop > 0)
+      {
+        RawSignal.Number = number;
+        memcpy(PULSES_STORAGE(RawSignal.Pulses), pulsesBackup, sizeof(PulseCode) * (number + 2));
+      }
+      if (!params::keepRepeatFilter)
+        resetRepeatFilter();
+
+      pbuffer[0] = 0;
+      RawSignal.readyForDecoder = true;
+
+      unsigned long long start = monotonicTime_ns();
+      gated = params::noiseGate && NoiseGate::isNoise(PulseSpan(RawSignal));
+      const bool votable = !gated && params::voteRepeats && RepeatVoting::keep(PulseSpan(RawSignal));
+      decoded = !gated && PluginRXCall(0, 0);
+      if (!decoded && !gated && params::realign)
+        decoded = Signal::decodeRealigned();
+      if (!decoded && votable)
+        decoded = RepeatVoting::decodeVoted();
+      counters::decodeTime_ns += monotonicTime_ns() - start;
+
+      RawSignal.readyForDecoder = false;
+      Signal::counters::receivedSignalsCount++;
+
+      if (decoded)
+      {
+        Signal::counters::successfullyDecodedSignalsCount++;
+        RepeatingTimer = millis() + Signal::params::signal_repeat_time;
+      }
+    }
+
+    counters::frames++;
+    if (gated)
+      counters::gatedFrames++;
+    if (decoded)
+    {
+      counters::decodedFrames++;
+      if (!params::quiet)
+        sendMsgFromBuffer();
+    }
+    pbuffer[0] = 0;
+
+    return decoded;
+  }
+
+  /**
+   * Parses the "Pulses(uSec)=" list of a 20;XX;DEBUG line
+   * */
+  bool loadDebugLine(const char *pulsesList)
+  {
+    int number = 0;
+    const char *cursor = pulsesList;
+
+    while (*cursor != 0 && *cursor != ';' && *cursor != '\r' && *cursor != '\n')
+    {
+      char *end;
+      unsigned long pulse_us = strtoul(cursor, &end, 10);
+      if (end == cursor)
+        return false;
+      if (number >= RAW_BUFFER_SIZE)
+        return false;
+
+      RawSignal.Pulses[++number] = pulse_us / Signal::params::sample_rate;
+      cursor = end;
+      if (*cursor == ',')
+        cursor++;
+    }
+
+    if (number < 2)
+      return false;
+
+    RawSignal.Number = number;
+    RawSignal.Multiply = Signal::params::sample_rate;
+    RawSignal.Pulses[0] = 0;
+    RawSignal.Time = millis();
+    RawSignal.rssi = -9999.0F;
+    RawSignal.endReason = EndReasons::Unknown;
+    return true;
+  }
+
+  bool loadLine(const char *line)
+  {
+    static const char debugPulsesTag[] = "Pulses(uSec)=";
+
+    const char *pulses = strstr(line, debugPulsesTag);
+    if (pulses != nullptr)
+      return loadDebugLine(pulses + strlen(debugPulsesTag));
+
+    const char *json = strchr(line, '{');
+    if (json != nullptr)
+    {
+      if (!getSignalFromJson(RawSignal, json))
+        return false;
+      RawSignal.Pulses[0] = 0;
+      RawSignal.Time = millis();
+      return true;
+    }
+
+    return false;
+  }
+
+  void processFrames(FILE *input)
+  {
+    static char line[RAW_BUFFER_SIZE * 8 + 256]; // enough for the longest DEBUG line
+
+    while (fgets(line, sizeof(line), input) != nullptr)
+    {
+      if (line[0] == '#' || line[0] == '\n' || line[0] == '\r' || line[0] == 0)
+        continue;
+
+      if (!loadLine(line))
+      {
+        counters::invalidLines++;
+        continue;
+      }
+      decodeRawSignal();
+    }
+  }
+
+  void processTrace(FILE *input)
+  {
+    ReplayPulseSource source(input, params::pollCost_us, params::rssiCost_us);
+    unsigned long long firstEdge_us = source.getVirtualTime_us();
+
+    setPulseSource(&source);
+
+    while (!source.exhausted())
+    {
+      if (fetchSignal())
+        decodeRawSignal();
+    }
+
+    setPulseSource(nullptr);
+    counters::replayedTime_us += source.getVirtualTime_us() - firstEdge_us;
+  }
+
+  void processInput(FILE *input)
+  {
+    if (params::traceInput)
+      processTrace(input);
+    else
+      processFrames(input);
+  }
+
+  void printSummary(unsigned long long elapsed_ns)
+  {
+    unsigned long long decodes = counters::frames * params::loops;
+
+    fprintf(stderr, "frames=%llu decoded=%llu invalid_lines=%llu", counters::frames, counters::decodedFrames, counters::invalidLines);
+    if (params::noiseGate)
+      fprintf(stderr, " gated=%llu", counters::gatedFrames);
+    fprintf(stderr, "\n");
+    if (decodes > 0 && counters::decodeTime_ns > 0)
+    {
+      fprintf(stderr, "PluginRXCall: %llu calls in %.3f ms, %.0f ns/call, %.0f decodes/sec\n",
+              decodes,
+              counters::decodeTime_ns / 1e6,
+              (double)counters::decodeTime_ns / decodes,
+              decodes * 1e9 / counters::decodeTime_ns);
+    }
+    if (params::traceInput && elapsed_ns > 0)
+    {
+      fprintf(stderr, "replayed %.3f s of RF traffic in %.3f s (x%.1f real time)\n",
+              counters::replayedTime_us / 1e6,
+              elapsed_ns / 1e9,
+              counters::replayedTime_us * 1e3 / elapsed_ns);
+    }
+  }
+
+  namespace Bench
+  {
+    struct Frame
+    {
+      int Number;
+      byte Multiply;
+      std::vector<PulseCode> Pulses; // Pulses[0..Number+1], as stored in RawSignal
+    };
+
+    struct PluginStats
+    {
+      byte index;
+      unsigned long long matchCalls;
+      unsigned long long matchTime_ns;
+      unsigned long long rejectCalls;
+      unsigned long long rejectTime_ns;
+    };
+
+    std::vector<Frame> frames;
+
+    void restoreFrame(const Frame &frame)
+    {
+      RawSignal.Number = frame.Number;
+      RawSignal.Multiply = frame.Multiply;
+      memcpy(PULSES_STORAGE(RawSignal.Pulses), frame.Pulses.data(), sizeof(PulseCode) * frame.Pulses.size());
+      RawSignal.readyForDecoder = true;
+      resetRepeatFilter();
+      pbuffer[0] = 0;
+    }
+
+    /**
+     * Time spent by the loop itself (frame restore, repeat filter reset), subtracted from every measure
+     * */
+    unsigned long long measureOverhead_ns(const Frame &frame)
+    {
+      unsigned long long start = monotonicTime_ns();
+      for (unsigned int loop = 0; loop < params::loops; loop++)
+        restoreFrame(frame);
+      return monotonicTime_ns() - start;
+    }
+
+    unsigned long long measure_ns(unsigned long long elapsed_ns, unsigned long long overhead_ns)
+    {
+      return elapsed_ns > overhead_ns ? elapsed_ns - overhead_ns : 0;
+    }
+
+    void loadFrames(FILE *input)
+    {
+      static char line[RAW_BUFFER_SIZE * 8 + 256];
+
+      while (fgets(line, sizeof(line), input) != nullptr)
+      {
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r' || line[0] == 0)
+          continue;
+
+        if (!loadLine(line))
+        {
+          counters::invalidLines++;
+          continue;
+        }
+
+        Frame frame;
+        frame.Number = RawSignal.Number;
+        frame.Multiply = RawSignal.Multiply;
+        frame.Pulses.assign(PULSES_STORAGE(RawSignal.Pulses), PULSES_STORAGE(RawSignal.Pulses) + RawSignal.Number + 2);
+        frame.Pulses[RawSignal.Number + 1] = 0;
+        frames.push_back(frame);
+      }
+    }
+
+    /**
+     * Plugins print debug text on stdout, it is silenced while measuring
+     * */
+    int silenceStdout()
+    {
+      fflush(stdout);
+      int saved = dup(fileno(stdout));
+      int devNull = open("/dev/null", O_WRONLY);
+      dup2(devNull, fileno(stdout));
+      close(devNull);
+      return saved;
+    }
+
+    void restoreStdout(int saved)
+    {
+      fflush(stdout);
+      dup2(saved, fileno(stdout));
+      close(saved);
+    }
+
+    void run()
+    {
+      static FrameFeatures features;
+      std::vector<PluginStats> stats;
+      unsigned long long featuresTime_ns = 0;
+      unsigned long long rxCallTime_ns = 0;
+      unsigned long long decodedFrames = 0;
+
+      if (frames.empty())
+      {
+        fprintf(stderr, "no frame to benchmark\n");
+        return;
+      }
+
+      int savedStdout = silenceStdout();
+
+      for (const Frame &frame : frames)
+      {
+        restoreFrame(frame);
+        PulseSpan span(RawSignal);
+        span.featuresCache = &features;
+
+        unsigned long long start = monotonicTime_ns();
+        for (unsigned int loop = 0; loop < params::loops; loop++)
+        {
+          features.computed = false;
+          span.features();
+        }
+        featuresTime_ns += monotonicTime_ns() - start;
+      }
+
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+      {
+        if ((Plugin_id[x] == 0) || (Plugin_State[x] < P_Enabled))
+          continue;
+
+        PluginStats pluginStats = {x, 0, 0, 0, 0};
+
+        for (const Frame &frame : frames)
+        {
+          unsigned long long overhead_ns = measureOverhead_ns(frame);
+          bool matched = false;
+
+          // as in PluginRXCall(), the features are computed once per frame and shared by the plugins,
+          // so they are computed here, outside the measure: their cost is the features line
+          restoreFrame(frame);
+          PulseSpan span(RawSignal);
+          features.computed = false;
+          span.featuresCache = &features;
+          span.features();
+
+          unsigned long long start = monotonicTime_ns();
+          for (unsigned int loop = 0; loop < params::loops; loop++)
+          {
+            restoreFrame(frame);
+            SignalHash = x;
+            matched = PluginSpan_ptr[x] != nullptr ? PluginSpan_ptr[x](span) : Plugin_ptr[x](0, 0);
+          }
+          unsigned long long elapsed_ns = measure_ns(monotonicTime_ns() - start, overhead_ns);
+
+          if (matched)
+          {
+            pluginStats.matchCalls += params::loops;
+            pluginStats.matchTime_ns += elapsed_ns;
+          }
+          else
+          {
+            pluginStats.rejectCalls += params::loops;
+            pluginStats.rejectTime_ns += elapsed_ns;
+          }
+        }
+        stats.push_back(pluginStats);
+      }
+
+      for (const Frame &frame : frames)
+      {
+        unsigned long long overhead_ns = measureOverhead_ns(frame);
+        bool decoded = false;
+
+        unsigned long long start = monotonicTime_ns();
+        for (unsigned int loop = 0; loop < params::loops; loop++)
+        {
+          restoreFrame(frame);
+          decoded = PluginRXCall(0, 0);
+        }
+        rxCallTime_ns += measure_ns(monotonicTime_ns() - start, overhead_ns);
+        if (decoded)
+          decodedFrames++;
+      }
+
+      restoreStdout(savedStdout);
+
+      unsigned long long totalRejectTime_ns = 0;
+      for (const PluginStats &pluginStats : stats)
+        totalRejectTime_ns += pluginStats.rejectTime_ns;
+
+      std::sort(stats.begin(), stats.end(), [](const PluginStats &a, const PluginStats &b)
+                { return a.rejectTime_ns > b.rejectTime_ns; });
+
+      printf("%zu frames, %u loops per frame, %zu plugins\n", frames.size(), params::loops, stats.size());
+      printf("plugin  %-28s %8s %10s %8s %10s %8s\n", "description", "matches", "ns/match", "rejects", "ns/reject", "reject%");
+      for (const PluginStats &pluginStats : stats)
+      {
+        printf("%03u     %-28.28s %8llu %10.0f %8llu %10.0f %7.1f%%\n",
+               Plugin_id[pluginStats.index],
+               Plugin_Description[pluginStats.index],
+               pluginStats.matchCalls / params::loops,
+               pluginStats.matchCalls > 0 ? (double)pluginStats.matchTime_ns / pluginStats.matchCalls : 0.0,
+               pluginStats.rejectCalls / params::loops,
+               pluginStats.rejectCalls > 0 ? (double)pluginStats.rejectTime_ns / pluginStats.rejectCalls : 0.0,
+               totalRejectTime_ns > 0 ? pluginStats.rejectTime_ns * 100.0 / totalRejectTime_ns : 0.0);
+      }
+      printf("features: %.0f ns/frame, left out of the plugin times, in PluginRXCall for the frames a plugin asks them for\n",
+             (double)featuresTime_ns / (frames.size() * params::loops));
+      printf("PluginRXCall: %llu/%zu frames decoded, %.0f ns/frame\n",
+             decodedFrames, frames.size(),
+             (double)rxCallTime_ns / (frames.size() * params::loops));
+    }
+  }
+
+  /**
+   * Pulse timing jitter of the RSSI_Advanced sync slicer: synthetic frames of known pulses are replayed
+   * through ReplayPulseSource, which charges rssiCost_us of virtual time for every RSSI read,
+   * and what the slicer measured is compared with what was sent, for several rssi_sample_interval values.
+   * */
+  namespace Jitter
+  {
+    const unsigned int framesCount = 200;
+    const unsigned int pulsesPerFrame = 64;
+    const unsigned long idleGap_us = 15000;
+    const unsigned int intervals_us[] = {0, 40, 80, 160};
+
+    struct Result
+    {
+      unsigned long long frames;
+      unsigned long long brokenFrames; // cut short or in pieces by the slicer, not compared
+      unsigned long long pulses;
+      unsigned long long rssiReads;
+      double errorSum_us;
+      double squaredErrorSum_us;
+      unsigned long maxError_us;
+    };
+
+    struct SentFrame
+    {
+      unsigned long long end_us;
+      std::vector<unsigned long> pulses;
+    };
+
+    std::vector<SentFrame> sentFrames;
+
+    /**
+     * Writes the edge trace of the synthetic frames, pulses are drawn between 150 and 1200us
+     * */
+    FILE *generateTrace()
+    {
+      FILE *trace = tmpfile();
+      unsigned long long now_us = idleGap_us;
+      unsigned long seed = 12345;
+
+      sentFrames.clear();
+      for (unsigned int f = 0; f < framesCount; f++)
+      {
+        std::vector<unsigned long> pulses;
+        int level = 1;
+        for (unsigned int i = 0; i < pulsesPerFrame; i++)
+        {
+          seed = seed * 1103515245UL + 12345UL;
+          unsigned long pulse_us = 150 + (seed >> 16) % 1050;
+          fprintf(trace, "%llu %d %d\n", now_us, level, level ? -60 : -70);
+          pulses.push_back(pulse_us);
+          now_us += pulse_us;
+          level = !level;
+        }
+        now_us -= pulses.back(); // the last pulse was a gap, the frame ends on a high one
+        pulses.pop_back();
+        fprintf(trace, "%llu 0 -100\n", now_us);
+        sentFrames.push_back({now_us, pulses});
+        now_us += idleGap_us;
+      }
+      rewind(trace);
+      return trace;
+    }
+
+    /**
+     * Compares RawSignal with the sent frame, the slicer may have kept the preamble or lost the first pulse
+     * */
+    void compareFrame(const std::vector<unsigned long> &sent, Result &result)
+    {
+      if (abs(RawSignal.Number - (int)sent.size()) > 2)
+      {
+        result.brokenFrames++;
+        return;
+      }
+
+      int bestOffset = -1;
+      double bestError = 0;
+
+      for (int offset = -1; offset <= 1; offset++)
+      {
+        double error = 0;
+        for (unsigned int i = 1; i < sent.size(); i++)
+        {
+          int measured = (int)i + offset;
+          if (measured < 1 || measured > RawSignal.Number)
+            continue;
+          error += fabs((double)RawSignal.Pulses[measured] * RawSignal.Multiply - (double)sent[i]);
+        }
+        if (bestOffset == -1 || error < bestError)
+        {
+          bestOffset = offset + 2;
+          bestError = error;
+        }
+      }
+
+      const int offset = bestOffset - 2;
+      for (unsigned int i = 1; i + 1 < sent.size(); i++) // the last pulse ends on the timeout
+      {
+        int measured = (int)i + offset;
+        if (measured < 1 || measured >= RawSignal.Number)
+          continue;
+        double error = (double)RawSignal.Pulses[measured] * RawSignal.Multiply - (double)sent[i];
+        result.pulses++;
+        result.errorSum_us += error;
+        result.squaredErrorSum_us += error * error;
+        if ((unsigned long)fabs(error) > result.maxError_us)
+          result.maxError_us = (unsigned long)fabs(error);
+      }
+    }
+
+    Result replay(unsigned int interval_us)
+    {
+      Result result = {0, 0, 0, 0, 0, 0, 0};
+      FILE *trace = generateTrace();
+      ReplayPulseSource source(trace, params::pollCost_us, params::rssiCost_us);
+      Signal::params::rssi_sample_interval = interval_us;
+      setPulseSource(&source);
+
+      while (!source.exhausted())
+      {
+        if (!fetchSignal())
+          continue;
+        // the slicer returns one signal_end_timeout after the end of the frame
+        const unsigned long long ended_us = source.getVirtualTime_us();
+        const SentFrame *sent = nullptr;
+        for (const SentFrame &frame : sentFrames)
+          if (frame.end_us <= ended_us)
+            sent = &frame;
+        if (sent == nullptr)
+          continue;
+        result.frames++;
+        compareFrame(sent->pulses, result);
+      }
+
+      setPulseSource(nullptr);
+      fclose(trace);
+      result.rssiReads = source.getRssiReadsCount();
+      return result;
+    }
+
+    void run()
+    {
+      updateSlicer(Slicer_enum::RSSI_Advanced);
+
+      printf("%u frames of %u pulses, level read %u us, RSSI read %u us\n", framesCount, pulsesPerFrame - 1, params::pollCost_us, params::rssiCost_us);
+      printf("%-10s %8s %8s %10s %10s %10s %10s %12s\n", "interval", "frames", "broken", "pulses", "mean_us", "stddev_us", "max_us", "rssi_reads");
+      for (unsigned int interval_us : intervals_us)
+      {
+        Result result = replay(interval_us);
+        double mean = result.pulses > 0 ? result.errorSum_us / result.pulses : 0;
+        double variance = result.pulses > 0 ? result.squaredErrorSum_us / result.pulses - mean * mean : 0;
+        printf("%-10u %8llu %8llu %10llu %10.1f %10.1f %10lu %12llu\n", interval_us, result.frames, result.brokenFrames, result.pulses,
+               mean, sqrt(variance > 0 ? variance : 0), result.maxError_us, result.rssiReads);
+      }
+    }
+  }
+
+  void usage(const char *name)
+  {
+    fprintf(stderr,
+            "Usage: %s [options] [file ...]\n"
+            "Decodes captured RF frames (20;XX;DEBUG lines or sendRF JSON) read from files or stdin.\n"
+            "  -q, --quiet             do not print decoded messages\n"
+            "  -d, --debug             print every frame before decoding it\n"
+            "  -r, --repeat-filter     keep the plugins repeat filter between frames\n"
+            "  -n, --loops N           decode every frame N times (timing)\n"
+            "  -t, --trace             inputs are edge traces to be cut into frames by the slicer\n"
+            "  -s, --slicer NAME       slicer used with --trace: legacy or rssi\n"
+            "  -b, --bench             time every plugin against every frame (default loops: 100)\n"
+            "  -v, --vote-repeats      when no plugin decodes a frame, vote its repeats and decode the result\n"
+            "  -a, --realign           when no plugin decodes a frame, decode it again without its first pulses\n"
+            "  -g, --noise-gate        drop the frames the noise gate scores as noise before the plugins\n"
+            "  -j, --jitter            measure the pulse timing error of the RSSI_Advanced slicer on synthetic frames\n"
+            "  -c, --capture FILE      also write every frame to FILE in the binary capture stream format\n"
+            "      --poll-cost US      virtual time spent by each level read (default 1)\n"
+            "      --rssi-cost US      virtual time spent by each RSSI read (default 30)\n",
+            name);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  enum
+  {
+    OPT_POLL_COST = 256,
+    OPT_RSSI_COST
+  };
+  static const struct option options[] = {
+      {"quiet", no_argument, nullptr, 'q'},
+      {"debug", no_argument, nullptr, 'd'},
+      {"repeat-filter", no_argument, nullptr, 'r'},
+      {"loops", required_argument, nullptr, 'n'},
+      {"trace", no_argument, nullptr, 't'},
+      {"slicer", required_argument, nullptr, 's'},
+      {"bench", no_argument, nullptr, 'b'},
+      {"vote-repeats", no_argument, nullptr, 'v'},
+      {"realign", no_argument, nullptr, 'a'},
+      {"noise-gate", no_argument, nullptr, 'g'},
+      {"jitter", no_argument, nullptr, 'j'},
+      {"capture", required_argument, nullptr, 'c'},
+      {"poll-cost", required_argument, nullptr, OPT_POLL_COST},
+      {"rssi-cost", required_argument, nullptr, OPT_RSSI_COST},
+      {"help", no_argument, nullptr, 'h'},
+      {nullptr, 0, nullptr, 0}};
+
+  Slicer_enum slicer = Slicer_enum::Legacy;
+  bool loopsSet = false;
+  int opt;
+
+  while ((opt = getopt_long(argc, argv, "qdrn:ts:bvagjc:h", options, nullptr)) != -1)
+  {
+    switch (opt)
+    {
+    case 'q':
+      Replay::params::quiet = true;
+      break;
+    case 'd':
+      Replay::params::showFrames = true;
+      break;
+    case 'r':
+      Replay::params::keepRepeatFilter = true;
+      break;
+    case 'n':
+      Replay::params::loops = atoi(optarg) > 0 ? atoi(optarg) : 1;
+      loopsSet = true;
+      break;
+    case 't':
+      Replay::params::traceInput = true;
+      break;
+    case 's':
+      if (strcasecmp(optarg, "legacy") == 0)
+        slicer = Slicer_enum::Legacy;
+      else if (strcasecmp(optarg, "rssi") == 0 || strcasecmp(optarg, "rssi_advanced") == 0)
+        slicer = Slicer_enum::RSSI_Advanced;
+      else
+      {
+        fprintf(stderr, "unknown slicer '%s'\n", optarg);
+        return 2;
+      }
+      break;
+    case 'b':
+      Replay::params::bench = true;
+      break;
+    case 'v':
+      Replay::params::voteRepeats = true;
+      break;
+    case 'a':
+      Replay::params::realign = true;
+      break;
+    case 'g':
+      Replay::params::noiseGate = true;
+      break;
+    case 'j':
+      Replay::params::jitter = true;
+      break;
+    case 'c':
+      Replay::params::captureFile = fopen(optarg, "wb");
+      if (Replay::params::captureFile == nullptr)
+      {
+        fprintf(stderr, "cannot create '%s'\n", optarg);
+        return 1;
+      }
+      break;
+    case OPT_POLL_COST:
+      Replay::params::pollCost_us = atoi(optarg);
+      break;
+    case OPT_RSSI_COST:
+      Replay::params::rssiCost_us = atoi(optarg);
+      break;
+    default:
+      Replay::usage(argv[0]);
+      return opt == 'h' ? 0 : 2;
+    }
+  }
+
+  Config::setup();
+  Signal::setup();
+  updateSlicer(slicer);
+  PluginInit();
+  PluginTXInit();
+  Plugins::setup();
+
+  if (Replay::params::jitter)
+  {
+    Replay::Jitter::run();
+    return 0;
+  }
+
+  if (Replay::params::bench)
+  {
+    if (!loopsSet)
+      Replay::params::loops = 100;
+
+    if (optind >= argc)
+      Replay::Bench::loadFrames(stdin);
+    for (int i = optind; i < argc; i++)
+    {
+      FILE *input = fopen(argv[i], "r");
+      if (input == nullptr)
+      {
+        fprintf(stderr, "cannot open '%s'\n", argv[i]);
+        return 1;
+      }
+      Replay::Bench::loadFrames(input);
+      fclose(input);
+    }
+    Replay::Bench::run();
+    return 0;
+  }
+
+  unsigned long long start = Replay::monotonicTime_ns();
+
+  if (optind >= argc)
+    Replay::processInput(stdin);
+
+  for (int i = optind; i < argc; i++)
+  {
+    FILE *input = fopen(argv[i], "r");
+    if (input == nullptr)
+    {
+      fprintf(stderr, "cannot open '%s'\n", argv[i]);
+      return 1;
+    }
+    Replay::processInput(input);
+    fclose(input);
+  }
+
+  fflush(stdout);
+  if (Replay::params::captureFile != nullptr)
+    fclose(Replay::params::captureFile);
+  Replay::printSummary(Replay::monotonicTime_ns() - start);
+
+  return 0;
+}
@@ -69,6 +69,7 @@
  \*********************************************************************************************/
 #define P001_PLUGIN_ID 001
 #define PLUGIN_DESC_001 "Long Packet Translation and debugging"
+#define PLUGIN_PULSES_001 PLUGIN_PULSES_ANY
 #define OVERSIZED_LIMIT 291 // longest packet is handled by plugin 48
 
 #define PULSE500_D 500
@@ -216,46 +217,39 @@ boolean Plugin_001(byte function, const char *string)
       //display_Name(PSTR("DEBUG"));
       //display_Footer();
       // ----------------------------------
-      RFLink::sendRawPrint(F("20;XX;DEBUG;Pulses=")); // debug data
-      RFLink::sendRawPrint(RawSignal.Number);         // print number of pulses
-      RFLink::sendRawPrint(F(";Pulses(uSec)="));      // print pulse durations
+      RFLink::LineWriter line;
+      line.print(F("20;XX;DEBUG;Pulses=")).print(RawSignal.Number); // debug data, number of pulses
+      line.print(F(";Pulses(uSec)="));                              // pulse durations
       // ----------------------------------
-      char dbuffer[10];
-
       for (i = 1; i < RawSignal.Number + 1; i++)
       {
          if (QRFDebug == true)
-         {
-            sprintf(dbuffer, "%02x", RawSignal.Pulses[i]);
-            RFLink::sendRawPrint(dbuffer);
-         }
+            line.printHex((uint16_t)RawSignal.Pulses[i], 2, false);
          else
          {
-            RFLink::sendRawPrint(RawSignal.Pulses[i] * RawSignal.Multiply);
+            line.print(RawSignal.Pulses[i] * RawSignal.Multiply);
             if (i < RawSignal.Number)
-               RFLink::sendRawPrint(',');
+               line.print(',');
          }
       }
-      RFLink::sendRawPrint(F(";RSSI="));
-      sprintf_P(dbuffer, PSTR("%i;"), (int)RawSignal.rssi);
-      RFLink::sendRawPrint(dbuffer);
+      line.print(F(";RSSI=")).print((int)RawSignal.rssi).print(';');
 
-      RFLink::sendRawPrint(F("REASON="));
-      RFLink::sendRawPrint(Signal::endReasonToString(RawSignal.endReason));
-      RFLink::sendRawPrint(F("\r\n"));
+      line.print(F("REASON=")).print(Signal::endReasonToString(RawSignal.endReason));
+      line.println();
 
 
       #ifdef RFLINK_SIGNAL_RSSI_DEBUG
-      RFLink::sendRawPrint(F("20;XX;DEBUG")); // debug data
-      RFLink::sendRawPrint(F(";RSSIs(uSec)="));      // print pulse durations
+      line.print(F("20;XX;DEBUG")); // debug data
+      line.print(F(";RSSIs(uSec)="));      // print pulse durations
       // ----------------------------------
       for (i = 1; i < RawSignal.Number + 1; i+=2)
       {
-            RFLink::sendRawPrint((int)RawSignal.Rssis[i]);
+            line.print((int)RawSignal.Rssis[i]);
             if (i < RawSignal.Number)
-               RFLink::sendRawPrint(',');
+               line.print(',');
       }
-      RFLink::sendRawPrint(F(";\r\n"));
+      line.print(';');
+      line.println();
       #endif
 
 
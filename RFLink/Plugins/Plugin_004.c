@@ -45,6 +45,7 @@
  \*********************************************************************************************/
 #define NewKAKU_PLUGIN_ID 004
 #define PLUGIN_DESC_004 "NewKaku"
+#define PLUGIN_PULSES_004 {NewKAKU_RawSignalLength, NewKAKU_RawSignalLength}, {NewKAKUdim_RawSignalLength, NewKAKUdim_RawSignalLength}
 #define NewKAKU_RawSignalLength 132            // regular KAKU packet length
 #define NewKAKUdim_RawSignalLength 148         // KAKU packet length including DIM bits
 #define NewKAKU_mT_D 650 // us, approx. in between 1T and 4T
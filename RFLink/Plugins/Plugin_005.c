@@ -40,6 +40,7 @@
  \*********************************************************************************************/
 #define EURODOMEST_PLUGIN_ID 005
 #define PLUGIN_DESC_005 "Eurodomest"
+#define PLUGIN_PULSES_005 {EURODOMEST_PulseLength, EURODOMEST_PulseLength}
 #define EURODOMEST_PulseLength 50
 
 #define EURODOMEST_PULSEMID_D 400
@@ -101,9 +102,7 @@ boolean Plugin_005(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(5, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform more sanity checks to prevent false positives
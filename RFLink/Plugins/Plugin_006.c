@@ -37,18 +37,19 @@
  \*********************************************************************************************/
 #define BLYSS_PLUGIN_ID 006
 #define PLUGIN_DESC_006 "Blyss / Avidsen"
+#define PLUGIN_PULSES_006 {BLYSS_PULSECOUNT, BLYSS_PULSECOUNT}
 #define BLYSS_PULSECOUNT 106
 #define BLYSS_PULSEMID_D 500
 
 #ifdef PLUGIN_006
 #include "../4_Display.h"
 
-boolean Plugin_006(byte function, const char *string)
+boolean Plugin_006(const PulseSpan &frame)
 {
-   if (RawSignal.Number != BLYSS_PULSECOUNT)
+   if (frame.Number != BLYSS_PULSECOUNT)
       return false;
 
-   const long BLYSS_PULSEMID = BLYSS_PULSEMID_D / RawSignal.Multiply;
+   const long BLYSS_PULSEMID = BLYSS_PULSEMID_D / frame.Multiply;
    unsigned long bitstream = 0L;
    unsigned long bitstream1 = 0L;
    byte bitcounter = 0;
@@ -59,7 +60,7 @@ boolean Plugin_006(byte function, const char *string)
    //==================================================================================
    for (byte x = 2; x < BLYSS_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x] > BLYSS_PULSEMID)
+      if (frame.Pulses[x] > BLYSS_PULSEMID)
       {
          if (bitcounter < 32)
          {
@@ -97,9 +98,7 @@ boolean Plugin_006(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream;   // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(6, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    byte status = ((bitstream1) >> 16) & 0x0f;
@@ -146,10 +145,13 @@ boolean Plugin_006(byte function, const char *string)
    display_CMD((status >> 1) & B01, !(status & B01)); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
+
+boolean Plugin_006(byte function, const char *string)
+{
+   return Plugin_006(PulseSpan(RawSignal));
+}
 #endif // PLUGIN_006
 
 #ifdef PLUGIN_TX_006
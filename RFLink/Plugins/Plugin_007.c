@@ -44,6 +44,7 @@
  \*********************************************************************************************/
 #define CONRADRSL2_PLUGIN_ID 007
 #define PLUGIN_DESC_007 "Conrad"
+#define PLUGIN_PULSES_007 {CONRADRSL2_PULSECOUNT, CONRADRSL2_PULSECOUNT}, {CONRADRSL2_PULSECOUNT + 2, CONRADRSL2_PULSECOUNT + 2}
 #define CONRADRSL2_PULSECOUNT 66
 
 #define CONRADRSL2_PULSEMID_D 600
@@ -96,9 +97,7 @@ boolean Plugin_007(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(7, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // all bits received, make sure checksum is okay
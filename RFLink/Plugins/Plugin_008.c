@@ -33,6 +33,7 @@
  \*********************************************************************************************/
 #define KAMBROOK_PLUGIN_ID 008
 #define PLUGIN_DESC_008 "Kambrook"
+#define PLUGIN_PULSES_008 {KAMBROOK_PULSECOUNT, KAMBROOK_PULSECOUNT}
 #define KAMBROOK_PULSECOUNT 96
 
 #define KAMBROOK_PULSEMID_D 400
@@ -40,12 +41,12 @@
 #ifdef PLUGIN_008
 #include "../4_Display.h"
 
-boolean Plugin_008(byte function, const char *string)
+boolean Plugin_008(const PulseSpan &frame)
 {
-    if (RawSignal.Number != KAMBROOK_PULSECOUNT)
+    if (frame.Number != KAMBROOK_PULSECOUNT)
         return false;
     
-    const long KAMBROOK_PULSEMID = KAMBROOK_PULSEMID_D / RawSignal.Multiply;
+    const long KAMBROOK_PULSEMID = KAMBROOK_PULSEMID_D / frame.Multiply;
 
     unsigned long address = 0L;
     byte sync = 0;
@@ -61,7 +62,7 @@ boolean Plugin_008(byte function, const char *string)
     //==================================================================================
     for (byte x = 1; x < KAMBROOK_PULSECOUNT; x += 2)
     {
-        if (RawSignal.Pulses[x] > KAMBROOK_PULSEMID)
+        if (frame.Pulses[x] > KAMBROOK_PULSEMID)
         {
             if (bitcounter < 8)
             {
@@ -147,10 +148,13 @@ boolean Plugin_008(byte function, const char *string)
     display_CMD(CMD_Single, (status & B01)); // #ALL #ON
     display_Footer();
     //==================================================================================
-    RawSignal.Repeats = true; // suppress repeats of the same RF packet
-    RawSignal.Number = 0;
     return true;
 }
+
+boolean Plugin_008(byte function, const char *string)
+{
+    return Plugin_008(PulseSpan(RawSignal));
+}
 #endif // PLUGIN_008
 
 #ifdef PLUGIN_TX_008
@@ -45,6 +45,7 @@
  \*********************************************************************************************/
 #define X10_PLUGIN_ID 009
 #define PLUGIN_DESC_009 "X10"
+#define PLUGIN_PULSES_009 {X10_PulseLength, X10_PulseLength}, {X10_PulseLength + 2, X10_PulseLength + 2}
 #define X10_PulseLength 66
 
 #define X10_PULSEMID_D 600
@@ -52,11 +53,11 @@
 #ifdef PLUGIN_009
 #include "../4_Display.h"
 
-boolean Plugin_009(byte function, const char *string)
+boolean Plugin_009(const PulseSpan &frame)
 {
-   if ((RawSignal.Number != (X10_PulseLength)) && (RawSignal.Number != (X10_PulseLength + 2)))
+   if ((frame.Number != (X10_PulseLength)) && (frame.Number != (X10_PulseLength + 2)))
       return false;
-   const long X10_PULSEMID = X10_PULSEMID_D / RawSignal.Multiply;
+   const long X10_PULSEMID = X10_PULSEMID_D / frame.Multiply;
    unsigned long bitstream = 0L;
    byte housecode = 0;
    byte unitcode = 0;
@@ -66,9 +67,9 @@ boolean Plugin_009(byte function, const char *string)
    //==================================================================================
    // Perform a pre sanity check
    //==================================================================================
-   if (RawSignal.Number == X10_PulseLength + 2)
+   if (frame.Number == X10_PulseLength + 2)
    {
-      if ((RawSignal.Pulses[1] * RawSignal.Multiply > 3000) && (RawSignal.Pulses[2] * RawSignal.Multiply > 3000))
+      if ((frame.Pulses[1] * frame.Multiply > 3000) && (frame.Pulses[2] * frame.Multiply > 3000))
          start = 2;
       else
          return false; // not an X10 packet
@@ -79,7 +80,7 @@ boolean Plugin_009(byte function, const char *string)
    for (byte x = 2 + start; x < ((X10_PulseLength) + start); x += 2)
    {
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > X10_PULSEMID)
+      if (frame.Pulses[x] > X10_PULSEMID)
          bitstream |= 0x1;
       // else
       //    bitstream |= 0x0;
@@ -92,9 +93,7 @@ boolean Plugin_009(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(9, bitstream, Signal::params::signal_repeat_time + 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    // order received data
@@ -281,10 +280,13 @@ boolean Plugin_009(byte function, const char *string)
    }
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
+
+boolean Plugin_009(byte function, const char *string)
+{
+   return Plugin_009(PulseSpan(RawSignal));
+}
 #endif //PLUGIN_009
 
 #ifdef PLUGIN_TX_009
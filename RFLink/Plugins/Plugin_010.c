@@ -47,6 +47,7 @@
  \*********************************************************************************************/
 #define RGB_PLUGIN_ID 010
 #define PLUGIN_DESC_010 "TRC02RGB"
+#define PLUGIN_PULSES_010 {RGB_MIN_PULSECOUNT, RGB_MAX_PULSECOUNT}
 #define RGB_MIN_PULSECOUNT 180
 #define RGB_MAX_PULSECOUNT 186
 
@@ -80,6 +80,7 @@
 
 #define HC_PLUGIN_ID 011
 #define PLUGIN_DESC_011 "HomeConfort"
+#define PLUGIN_PULSES_011 {HC_PULSECOUNT, HC_PULSECOUNT}
 #define HC_PULSECOUNT 100
 #define HC_PULSE_PREAMBLE_D 2400
 #define HC_PULSE_MID_D 500
@@ -78,6 +78,7 @@
  \*********************************************************************************************/
 #define FA500_PLUGIN_ID 012
 #define PLUGIN_DESC_012 "FA500"
+#define PLUGIN_PULSES_012 {FA500RM3_PulseLength, FA500RM3_PulseLength}, {FA500RM1_PulseLength, FA500RM1_PulseLength}
 #define FA500RM3_PulseLength 26
 #define FA500RM1_PulseLength 58
 
@@ -86,12 +87,12 @@
 #ifdef PLUGIN_012
 #include "../4_Display.h"
 
-boolean Plugin_012(byte function, const char *string)
+boolean Plugin_012(const PulseSpan &frame)
 {
-   if (RawSignal.Number != (FA500RM3_PulseLength) && RawSignal.Number != (FA500RM1_PulseLength))
+   if (frame.Number != (FA500RM3_PulseLength) && frame.Number != (FA500RM1_PulseLength))
       return false;
 
-   const long FA500_PULSEMID = FA500_PULSEMID_D / RawSignal.Multiply;
+   const long FA500_PULSEMID = FA500_PULSEMID_D / frame.Multiply;
 
    byte type = 0; // 0=KAKU 1=ITK 2=PT2262
    byte housecode = 0;
@@ -102,14 +103,14 @@ boolean Plugin_012(byte function, const char *string)
    //==================================================================================
    // Get all 28 bits
    //==================================================================================
-   if (RawSignal.Number == (FA500RM3_PulseLength))
+   if (frame.Number == (FA500RM3_PulseLength))
    {
       // get all 26pulses =>24 manchester bits => 12 actual bits
       type = 0;
       for (byte x = 2; x <= FA500RM3_PulseLength - 2; x += 2)
       {                   // Method 3
          bitstream <<= 1; // Always shift
-         if (RawSignal.Pulses[x] > FA500_PULSEMID)
+         if (frame.Pulses[x] > FA500_PULSEMID)
             bitstream |= 0x1;
          // else
          //    bitstream |= 0x0;
@@ -122,7 +123,7 @@ boolean Plugin_012(byte function, const char *string)
       for (byte x = 1; x <= FA500RM1_PulseLength - 2; x += 2)
       {                   // method 1
          bitstream <<= 1; // Always shift
-         if (RawSignal.Pulses[x] > FA500_PULSEMID)
+         if (frame.Pulses[x] > FA500_PULSEMID)
             bitstream |= 0x1;
          // else
          //    bitstream |= 0x0;
@@ -177,11 +178,11 @@ boolean Plugin_012(byte function, const char *string)
       }
       command = 2; // initialize to "unknown"
       // Trick: here we use the on/off command from the other packet type as it is not detected in the current packet, it was passed via Pluses[0] in plugin 1
-      if (RawSignal.Pulses[0] * RawSignal.Multiply > 1000 && RawSignal.Pulses[0] * RawSignal.Multiply < 1400)
+      if (frame.Pulses[0] * frame.Multiply > 1000 && frame.Pulses[0] * frame.Multiply < 1400)
       {
          command = 0;
       }
-      else if (RawSignal.Pulses[0] * RawSignal.Multiply > 100 && RawSignal.Pulses[0] * RawSignal.Multiply < 400)
+      else if (frame.Pulses[0] * frame.Multiply > 100 && frame.Pulses[0] * frame.Multiply < 400)
       {
          command = 1;
       }
@@ -233,9 +234,13 @@ boolean Plugin_012(byte function, const char *string)
    }
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
+
+boolean Plugin_012(byte function, const char *string)
+{
+   return Plugin_012(PulseSpan(RawSignal));
+}
 #endif //PLUGIN_012
 
 #ifdef PLUGIN_TX_012
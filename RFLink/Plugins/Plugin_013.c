@@ -90,6 +90,7 @@
  \*********************************************************************************************/
 #define POWERFIX_PLUGIN_ID 013
 #define PLUGIN_DESC_013 "Powerfix"
+#define PLUGIN_PULSES_013 {POWERFIX_PulseLength, POWERFIX_PulseLength}
 #define POWERFIX_PulseLength 42
 
 #define POWEFIX_PULSEMID_D 900
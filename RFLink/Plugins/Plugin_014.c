@@ -35,6 +35,7 @@
  \*********************************************************************************************/
 #define KOPPLA_PLUGIN_ID 014
 #define PLUGIN_DESC_014 "Ikea Koppla"
+#define PLUGIN_PULSES_014 {KOPPLA_PulseLength_MIN, KOPPLA_PulseLength_MAX}
 #define KOPPLA_PulseLength_MIN 36
 #define KOPPLA_PulseLength_MAX 52
 
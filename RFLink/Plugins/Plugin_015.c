@@ -49,6 +49,7 @@
  \*********************************************************************************************/
 #define HomeEasy_PLUGIN_ID 015
 #define PLUGIN_DESC_015 "HomeEasy"
+#define PLUGIN_PULSES_015 {HomeEasy_PulseLength, HomeEasy_PulseLength}
 #define HomeEasy_PulseLength 116
 
 #define HomeEasy_PULSEMID_D 500
@@ -1,5 +1,6 @@
 #define SILVERCREST_PLUGIN_ID 016
 #define PLUGIN_DESC_016 "Silvercrest remote controlled power sockets"
+#define PLUGIN_PULSES_016 {SLVCR_MinPulses, SLVCR_MaxPulses}
 #define SerialDebugActivated
 
 #ifdef PLUGIN_016
@@ -10,6 +11,8 @@
 #define PLUGIN_016_ID "Silvercrest"
 //#define PLUGIN_016_DEBUG
 
+const int SLVCR_MinPulses = 180;
+const int SLVCR_MaxPulses = 320;
 const int SLVCR_BitCount = 24;
 const int8_t SLVCR_CodeCount = 8;
 const uint16_t SLVCR_OnCodes[SLVCR_CodeCount] = {0xf756, 0x7441, 0xd9c5, 0xe3aa, 0x6af3, 0x453f, 0x0f6e, 0xc170};
@@ -17,9 +20,6 @@ const uint16_t SLVCR_OffCodes[SLVCR_CodeCount] = {0x20e7, 0x5212, 0x9d88, 0x8c0b
 
 boolean Plugin_016(byte function, const char *string)
 {
-   const int SLVCR_MinPulses = 180;
-   const int SLVCR_MaxPulses = 320;
-
    if (RawSignal.Number >= SLVCR_MinPulses && RawSignal.Number <= SLVCR_MaxPulses) 
    {
       const int SLVCR_StartPulseDuration = 2000 / RawSignal.Multiply;
@@ -1,5 +1,6 @@
 #define RTS_PLUGIN_ID 017
 #define PLUGIN_DESC_017 "RTS remote controlled devices"
+#define PLUGIN_PULSES_017 {RTS_MinPulses, RTS_MaxPulses}
 //#define SerialDebugActivated
 //#define PLUGIN_017_DEBUG
 
@@ -36,6 +37,8 @@
 
 const int bitsPerByte = 8;
 
+const int RTS_MinPulses = 85;
+const int RTS_MaxPulses = 105;
 const int RTS_EEPROMBaseAddress = 0;
 const int RTS_ExpectedByteCount = 7;
 const int RTS_ExpectedBitCount = RTS_ExpectedByteCount * bitsPerByte;
@@ -46,9 +49,6 @@ const int RTS_SoftwareSyncPulseDurationBase = 4500;
 
 boolean Plugin_017(byte function, const char *string)
 {
-    const int RTS_MinPulses = 85;
-    const int RTS_MaxPulses = 105;
-
    // ;Pulses=82;Pulses(uSec)=2449,2542,4787,1299,1264,674,612,1311,1263,1301,1261,666,608,1315,1255,683,610,663,615,679,611,1299,1263,1307,611,679,1263,663,611,1309,610,666,1255,1315,1255,682,606,1316,611,665,605,678,1248,679,611,1310,1259,1300,611,679,1259,1311,1259,1311,1263,675,603,679,611,1311,1259,667,611,1311,1259,1311,611,667,611,679,611,667,612,678,1247,1315,608,678,600,678,1260,0
 
    if (RawSignal.Number >= RTS_MinPulses && RawSignal.Number <= RTS_MaxPulses) 
@@ -51,6 +51,7 @@
  \*********************************************************************************************/
 #define DKW2012_PLUGIN_ID 029
 #define PLUGIN_DESC_029 "Alecto V2 / DKW2012"
+#define PLUGIN_PULSES_029 {ACH2010_MIN_PULSECOUNT, ACH2010_MAX_PULSECOUNT}, {DKW2012_MIN_PULSECOUNT, DKW2012_MAX_PULSECOUNT}
 
 #define ACH2010_MIN_PULSECOUNT 160 // reduce this value (144?) in case of bad reception
 #define ACH2010_MAX_PULSECOUNT 160
@@ -123,9 +124,7 @@ boolean Plugin_029(byte function, const char *string)
   //==================================================================================
   unsigned long tmpval = data[0] << 8 | data[1];
 
-  if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || (SignalCRC != tmpval))
-    SignalCRC = tmpval; // not seen the RF packet recently
-  else
+  if (!DedupCache::isNewPayload(29, tmpval, Signal::params::signal_repeat_time + 1000))
     return true; // already seen the RF packet recently
   //==================================================================================
   // Now process the various sensor types
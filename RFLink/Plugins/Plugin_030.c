@@ -94,6 +94,7 @@
  \*********************************************************************************************/
 #define ALECTOV1_PLUGIN_ID 030
 #define PLUGIN_DESC_030 "Alecto V1"
+#define PLUGIN_PULSES_030 {ALECTOV1_PULSECOUNT, ALECTOV1_PULSECOUNT}
 #define ALECTOV1_PULSECOUNT 74
 
 #define ALECTOV1_MIDHI_D 700
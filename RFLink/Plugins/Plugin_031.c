@@ -65,6 +65,7 @@
  \*********************************************************************************************/
 #define ALECTOV3_PLUGIN_ID 031
 #define PLUGIN_DESC_031 "Alecto V3"
+#define PLUGIN_PULSES_031 {WS1100_PULSECOUNT, WS1100_PULSECOUNT}, {WS1200_PULSECOUNT, WS1200_PULSECOUNT}
 #define WS1100_PULSECOUNT 94
 #define WS1200_PULSECOUNT 126
 
@@ -76,12 +77,12 @@
 uint8_t Plugin_031_ProtocolAlectoCRC8(uint8_t *addr, uint8_t len);
 // unsigned int Plugin_031_ProtocolAlectoRainBase = 0;
 
-boolean Plugin_031(byte function, const char *string)
+boolean Plugin_031(const PulseSpan &frame)
 {
-   if ((RawSignal.Number != WS1100_PULSECOUNT) && (RawSignal.Number != WS1200_PULSECOUNT))
+   if ((frame.Number != WS1100_PULSECOUNT) && (frame.Number != WS1200_PULSECOUNT))
       return false;
 
-   const long ALECTOV3_PULSEMID = ALECTOV3_PULSEMID_D / RawSignal.Multiply;
+   const long ALECTOV3_PULSEMID = ALECTOV3_PULSEMID_D / frame.Multiply;
 
    unsigned long bitstream1 = 0L;
    unsigned long bitstream2 = 0L;
@@ -98,7 +99,7 @@ boolean Plugin_031(byte function, const char *string)
    for (byte x = 15; x <= 77; x += 2)
    {                    // get first 32 relevant bits
       bitstream1 <<= 1; // Always shift
-      if (RawSignal.Pulses[x] < ALECTOV3_PULSEMID)
+      if (frame.Pulses[x] < ALECTOV3_PULSEMID)
          bitstream1 |= 0x1;
       // else
       //    bitstream1 |= 0x0;
@@ -106,7 +107,7 @@ boolean Plugin_031(byte function, const char *string)
    for (byte x = 79; x <= 141; x = x + 2)
    {                    // get second 32 relevant bits
       bitstream2 <<= 1; // Always shift
-      if (RawSignal.Pulses[x] < ALECTOV3_PULSEMID)
+      if (frame.Pulses[x] < ALECTOV3_PULSEMID)
          bitstream2 |= 0x1;
       // else
       //    bitstream2 |= 0x0;
@@ -128,7 +129,7 @@ boolean Plugin_031(byte function, const char *string)
    //==================================================================================
    // Perform checksum calculations
    //==================================================================================
-   if (RawSignal.Number == WS1200_PULSECOUNT)
+   if (frame.Number == WS1200_PULSECOUNT)
    { // verify checksum
       checksum = (bitstream2 >> 8) & 0xFF;
       checksumcalc = Plugin_031_ProtocolAlectoCRC8(data, 6);
@@ -163,7 +164,7 @@ boolean Plugin_031(byte function, const char *string)
    display_IDn(rc, 2);
    display_TEMP(temperature);
 
-   if (RawSignal.Number == WS1100_PULSECOUNT)
+   if (frame.Number == WS1100_PULSECOUNT)
    {
       humidity = bitstream1 & 0xFF; // alleen op WS1100?
       display_HUM(humidity);
@@ -183,11 +184,14 @@ boolean Plugin_031(byte function, const char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;     // do not process the packet any further
    return true;
 }
 
+boolean Plugin_031(byte function, const char *string)
+{
+   return Plugin_031(PulseSpan(RawSignal));
+}
+
 /*********************************************************************************************\
  * Calculates CRC-8 checksum
  * reference http://lucsmall.com/2012/04/29/weather-station-hacking-part-2/
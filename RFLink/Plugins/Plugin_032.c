@@ -41,6 +41,7 @@
  \*********************************************************************************************/
 #define ALECTOV4_PLUGIN_ID 032
 #define PLUGIN_DESC_032 "Alecto V4"
+#define PLUGIN_PULSES_032 {ALECTOV4_PULSECOUNT, ALECTOV4_PULSECOUNT + 4}
 #define ALECTOV4_PULSECOUNT 74
 
 #define ALECTOV4_MIDHI_D 550
@@ -152,9 +153,7 @@ boolean Plugin_032(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (((bitstream << 8) & 0xFFF0) | humidity); // All but 8 1st ID bits ...
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (!DedupCache::isNewPayload(32, tmpval, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
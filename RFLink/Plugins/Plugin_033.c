@@ -33,6 +33,7 @@
  \*********************************************************************************************/
 #define CONRAD_PLUGIN_ID 033
 #define PLUGIN_DESC_033 "Conrad"
+#define PLUGIN_PULSES_033 {CONRAD_PULSECOUNT, CONRAD_PULSECOUNT}
 #define CONRAD_PULSECOUNT 80
 
 #define CONRAD_PULSEMAX_D 5000
@@ -96,9 +97,7 @@ boolean Plugin_033(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(33, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
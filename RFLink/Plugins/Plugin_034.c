@@ -27,6 +27,7 @@
  \*********************************************************************************************/
 #define CRESTA_PLUGIN_ID 034
 #define PLUGIN_DESC_034 "Cresta"
+#define PLUGIN_PULSES_034 {CRESTA_MIN_PULSECOUNT, CRESTA_MAX_PULSECOUNT}
 
 #define CRESTA_MIN_PULSECOUNT 124 // unknown until we have a collection of all packet types but this seems to be the minimum
 #define CRESTA_MAX_PULSECOUNT 284 // unknown until we have a collection of all packet types
@@ -205,9 +206,7 @@ boolean Plugin_034(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = ((unsigned long)data[3] << 16) | ((data[1]) << 8) | channel;
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(34, tmpval, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    // ----------------------------------
    battery = !((data[2]) >> 6);
@@ -38,6 +38,7 @@
  \*********************************************************************************************/
 #define IMAGINTRONIX_PLUGIN_ID 035
 #define PLUGIN_DESC_035 "Imagintronix"
+#define PLUGIN_PULSES_035 {IMAGINTRONIX_PULSECOUNT, IMAGINTRONIX_PULSECOUNT}
 
 #define IMAGINTRONIX_PULSECOUNT 96
 
@@ -117,9 +118,7 @@ boolean Plugin_035(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(35, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    rc = (data[1]) & 0x3;
@@ -32,70 +32,36 @@
 
 #define F007_TH_PLUGIN_ID 036
 #define PLUGIN_DESC_036 "F007_TH"
+#define PLUGIN_PULSES_036 {F007_TH_PULSECOUNT, F007_TH_PULSECOUNT}
 #define F007_TH_PULSECOUNT 111
 
 #define F007_TH_PULSE_MID_D  650
 
 #ifdef PLUGIN_036
 #include "../4_Display.h"
+#include "../20_OokDecoder.h"
 
-boolean Plugin_036(byte function, const char *string)
-{
-   if (RawSignal.Number != F007_TH_PULSECOUNT)
-      return false;
-
-   const long F007_TH_PULSE_MID = F007_TH_PULSE_MID_D / RawSignal.Multiply;
-
-   byte toggle = 1;
-   byte pulsecounter = 2;                                            // Pulse counter
-   int bitcounter = 0;                                               // Bits counter 
-   unsigned long headerstream = 0L ;                                 // Must be 111 1111 1101 0100 0101 (9 1's + '01' + 0x45) -> 19 Bits
-   unsigned long datastream = 0L;                                    // Only the 32 first bits are processed, not the checksum
+// 19 bits of header, 111 1111 1101 0100 0101 (9 1's + '01' + 0x45), the first 18 are checked
+// then 32 bits of data, the checksum after them is not processed
+static constexpr OokDecoder::Protocol F007_TH_PROTOCOL PROGMEM =
+    OokDecoder::manchester(F007_TH_PULSECOUNT, 2, 51, F007_TH_PULSE_MID_D, 1).withHeader(18, 0x3FEA2);
+static_assert(OokDecoder::isValid(F007_TH_PROTOCOL), "invalid F007_TH protocol");
 
+boolean Plugin_036(const PulseSpan &frame)
+{
    //==================================================================================
    // Get bits
    //==================================================================================
-
-   while(bitcounter < 51)
-   {
-      bitcounter++;
-      if (RawSignal.Pulses[pulsecounter] < F007_TH_PULSE_MID)
-      {                                                              // Short pulse in second half-bit -> same value
-         if (RawSignal.Pulses[pulsecounter+1] > F007_TH_PULSE_MID)   // First :Manchester check, the next pulse must alway be short
-            return false;                                            // Invalid Manchester code
-         pulsecounter += 2;                                          // Manchester OK -> don't toggle bit, move ahead to next half-bit
-      }
-      else
-      {                                                              // Long pulse in second half-bit -> invert bit value
-         toggle ^= 0x1;                                              // Invert bit value
-         pulsecounter += 1;                                          // Move ahead to next pulse
-      }
-      if ((bitcounter <= 9 || bitcounter == 11) && toggle == 0)      // Quick sanity checks : Bits 1-9 and 11 must be 1
-         return false;                                               // Invalid 0 in header (sometimes good data, but mised some bits)
-      if (bitcounter == 19)                                          // Longer sanity check : Header must be 0x7FD45
-      {
-         if (headerstream != 0x3FEA2)
-            return false;                                            // Invalid header
-      }      
-      if (bitcounter < 19)
-      {                                                              // Store in header
-         headerstream <<= 1;
-         headerstream |= toggle;                                     
-      }
-      else
-      {                                                              // Store data
-         datastream <<= 1;
-         datastream |= toggle;   
-      }
-   }
+   uint64_t bits;
+   if (!OokDecoder::decode(frame, F007_TH_PROTOCOL, bits))
+      return false;
+   const unsigned long datastream = (uint32_t)bits;
 
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer) + 700 < millis()) || (SignalCRC != datastream))
-      SignalCRC = datastream;
-   else
-      return true; // packet already seen
+   if (!DedupCache::isNewPayload(36, datastream, Signal::params::signal_repeat_time + 700))
+      return true; // already seen the RF packet recently
 
    //==================================================================================
    // Extract data
@@ -122,8 +88,11 @@ boolean Plugin_036(byte function, const char *string)
    display_Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
+
+boolean Plugin_036(byte function, const char *string)
+{
+   return Plugin_036(PulseSpan(RawSignal));
+}
 #endif // Plugin_036
@@ -40,6 +40,7 @@
  *  \*********************************************************************************************/
 #define ACURITE_PLUGIN_ID 037
 #define PLUGIN_DESC_037 "AcuRite 986"
+#define PLUGIN_PULSES_037 {ACURITE_PULSECOUNT, ACURITE_PULSECOUNT + 4}
 #define ACURITE_PULSECOUNT 84
 
 #define ACURITE_MIDHI_D 2000
@@ -51,13 +52,13 @@
 #ifdef PLUGIN_037
 #include "../4_Display.h"
 
-boolean Plugin_037(byte function, const char *string)
+boolean Plugin_037(const PulseSpan &frame)
 {
-   if (RawSignal.Number < ACURITE_PULSECOUNT || RawSignal.Number > (ACURITE_PULSECOUNT + 4))
+   if (frame.Number < ACURITE_PULSECOUNT || frame.Number > (ACURITE_PULSECOUNT + 4))
       return false;
 
-   const long ACURITE_MIDHI = ACURITE_MIDHI_D / RawSignal.Multiply;
-   const long ACURITE_PULSEMAXMIN = ACURITE_PULSEMAXMIN_D / RawSignal.Multiply;
+   const long ACURITE_MIDHI = ACURITE_MIDHI_D / frame.Multiply;
+   const long ACURITE_PULSEMAXMIN = ACURITE_PULSEMAXMIN_D / frame.Multiply;
 
    unsigned long bitstream = 0L;
    byte bitstream2 = 0;
@@ -74,10 +75,10 @@ boolean Plugin_037(byte function, const char *string)
    // Serial.print("Bitstream: ");
    for (byte x = 0; x < 64; x += 2)
    {
-      if (RawSignal.Pulses[x + 1] > ACURITE_MIDHI)
+      if (frame.Pulses[x + 1] > ACURITE_MIDHI)
          return false; // in between pulses should be short
       bitstream <<= 1;
-      if (RawSignal.Pulses[x + 1] > ACURITE_PULSEMAXMIN)
+      if (frame.Pulses[x + 1] > ACURITE_PULSEMAXMIN)
       {
          bitstream |= 0x1;
          // Serial.print("1");
@@ -92,7 +93,7 @@ boolean Plugin_037(byte function, const char *string)
    {
       bitstream2 <<= 1;
 
-      if (RawSignal.Pulses[x + 1] > ACURITE_PULSEMAXMIN)
+      if (frame.Pulses[x + 1] > ACURITE_PULSEMAXMIN)
       {
          bitstream2 |= 0x1;
          // Serial.print("1");
@@ -174,9 +175,7 @@ boolean Plugin_037(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (((bitstream << 8) & 0xFFF0)); // All but 8 1st ID bits ...
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (!DedupCache::isNewPayload(37, tmpval, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -190,8 +189,11 @@ boolean Plugin_037(byte function, const char *string)
    display_BAT(battery);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
+
+boolean Plugin_037(byte function, const char *string)
+{
+   return Plugin_037(PulseSpan(RawSignal));
+}
 #endif // PLUGIN_037
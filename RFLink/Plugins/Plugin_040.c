@@ -46,6 +46,7 @@
 // ==================================================================================
 #define MEBUS_PLUGIN_ID 040
 #define PLUGIN_DESC_040 "Mebus"
+#define PLUGIN_PULSES_040 {MEBUS_PULSECOUNT, MEBUS_PULSECOUNT}
 #define MEBUS_PULSECOUNT 58
 
 #define MEBUS_MIDHI_D 550
@@ -81,6 +81,7 @@
  \*********************************************************************************************/
 #define LACROSSE41_PLUGIN_ID 041
 #define PLUGIN_DESC_041 "LaCrosseV3"
+#define PLUGIN_PULSES_041 {LACROSSE41_PULSECOUNT1, LACROSSE41_PULSECOUNT1}, {LACROSSE41_PULSECOUNT3, LACROSSE41_PULSECOUNT3}, {LACROSSE41_PULSECOUNT4, LACROSSE41_PULSECOUNT4}, {LACROSSE41_PULSECOUNT2, LACROSSE41_PULSECOUNT2}
 
 #define LACROSSE41_PULSECOUNT1 92  // Rain sensor
 #define LACROSSE41_PULSECOUNT2 162 // Meteo sensor
@@ -166,10 +167,8 @@ boolean Plugin_041(byte function, const char *string)
    //==================================================================================
    unsigned long tempval = (((unsigned long)(data[4]) >> 1) << 16) | ((data[3]) << 8) | data[2];
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 150) < millis()) || (SignalCRC != tempval))
-      SignalCRC = tempval; // not seen this RF packet recently
-   else
-      return true; // already seen the RF packet recently, but still want the humidity
+   if (!DedupCache::isNewPayload(41, tempval, Signal::params::signal_repeat_time + 150))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
    //==================================================================================
@@ -89,6 +89,7 @@
  \*********************************************************************************************/
 #define UPM_PLUGIN_ID 042
 #define PLUGIN_DESC_042 "UPM/Esic / UPM/Esic F2"
+#define PLUGIN_PULSES_042 {UPM_MIN_PULSECOUNT, UPM_MAX_PULSECOUNT}
 
 #define UPM_MIN_PULSECOUNT 46
 #define UPM_MAX_PULSECOUNT 56
@@ -211,9 +212,7 @@ boolean Plugin_042(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream1))
-      SignalCRC = bitstream1; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(42, bitstream1, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -89,6 +89,7 @@
   \*********************************************************************************************/
 #define LACROSSE43_PLUGIN_ID 043
 #define PLUGIN_DESC_043 "LaCrosse"
+#define PLUGIN_PULSES_043 {LACROSSE43_PULSECOUNT - 4, LACROSSE43_PULSECOUNT + 4}
 
 #define LACROSSE43_PULSECOUNT 88 // also handles 84 to 92 pulses!
 
@@ -210,10 +211,8 @@ boolean Plugin_043(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 4) | (data[10]); // sensor type + ID + checksum
 
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
-      return true; // already seen the RF packet recently, but still want the humidity
+   if (!DedupCache::isNewPayload(43, tmpval, Signal::params::signal_repeat_time))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
    //==================================================================================
@@ -36,6 +36,7 @@
  \*********************************************************************************************/
 #define AURIOLV3_PLUGIN_ID 044
 #define PLUGIN_DESC_044 "Auriol V3"
+#define PLUGIN_PULSES_044 {AURIOLV3_PULSECOUNT, AURIOLV3_PULSECOUNT}
 #define AURIOLV3_PULSECOUNT 82
 
 #define AURIOLV3_MIDHI_D 650
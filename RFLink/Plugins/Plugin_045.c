@@ -34,6 +34,7 @@
  \*********************************************************************************************/
 #define AURIOL_PLUGIN_ID 045
 #define PLUGIN_DESC_045 "Auriol"
+#define PLUGIN_PULSES_045 {AURIOL_PULSECOUNT, AURIOL_PULSECOUNT}
 #define AURIOL_PULSECOUNT 66
 
 #define AURIOL_MIDHI_D 550
@@ -112,9 +113,7 @@ boolean Plugin_045(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(45, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -46,6 +46,7 @@
  \*********************************************************************************************/
 #define AURIOLV2_PLUGIN_ID 046
 #define PLUGIN_DESC_046 "Auriol V2 / Xiron"
+#define PLUGIN_PULSES_046 {AURIOLV2_PULSECOUNT, AURIOLV2_PULSECOUNT}
 
 #define AURIOLV2_PULSECOUNT 74
 
@@ -58,17 +59,22 @@
 #ifdef PLUGIN_046
 #include "../4_Display.h"
 
-boolean Plugin_046(byte function, const char *string)
+boolean Plugin_046(const PulseSpan &frame)
 {
-   if (RawSignal.Number != AURIOLV2_PULSECOUNT)
+   if (frame.Number != AURIOLV2_PULSECOUNT)
       return false;
 
-   const long AURIOLV2_MIDHI = AURIOLV2_MIDHI_D / RawSignal.Multiply;
-   const long AURIOLV2_PULSEMIN = AURIOLV2_PULSEMIN_D / RawSignal.Multiply;
-   const long AURIOLV2_PULSEMINMAX = AURIOLV2_PULSEMINMAX_D / RawSignal.Multiply;
-   const long AURIOLV2_PULSEMAXMIN = AURIOLV2_PULSEMAXMIN_D / RawSignal.Multiply;
-   const long AURIOLV2_PULSEMAX = AURIOLV2_PULSEMAX_D / RawSignal.Multiply;
+   const long AURIOLV2_MIDHI = AURIOLV2_MIDHI_D / frame.Multiply;
+   const long AURIOLV2_PULSEMIN = AURIOLV2_PULSEMIN_D / frame.Multiply;
+   const long AURIOLV2_PULSEMINMAX = AURIOLV2_PULSEMINMAX_D / frame.Multiply;
+   const long AURIOLV2_PULSEMAXMIN = AURIOLV2_PULSEMAXMIN_D / frame.Multiply;
+   const long AURIOLV2_PULSEMAX = AURIOLV2_PULSEMAX_D / frame.Multiply;
 
+   const FrameFeatures &features = frame.features(); // the gaps below hold all of the frame but the last one
+   if (features.gaps.min < AURIOLV2_PULSEMIN || features.gaps.max > AURIOLV2_PULSEMAX)
+      return false;
+   if (features.marks.min > AURIOLV2_MIDHI)
+      return false;
 
    unsigned long bitstream1 = 0L; // holds first 6x4=24 bits
    unsigned long bitstream2 = 0L; // holds last  3x4=12 bits
@@ -83,13 +89,18 @@ boolean Plugin_046(byte function, const char *string)
    //==================================================================================
    // Get all 36 bits
    //==================================================================================
+   // when the short/long split of the gaps is ours and none is between short and long, the features hold the bits
+   const bool gapsSplit = features.gaps.splitAt(AURIOLV2_PULSEMAXMIN) && features.gaps.shortMax <= AURIOLV2_PULSEMINMAX;
+   // the marks also hold Pulses[1], which is not checked: each mark is looked at only when one is too long
+   const bool marksShort = features.marks.max <= AURIOLV2_MIDHI;
+
    for (byte x = 2; x < (AURIOLV2_PULSECOUNT); x += 2)
    {
-      if (RawSignal.Pulses[x + 1] > AURIOLV2_MIDHI)
+      if (!marksShort && frame.Pulses[x + 1] > AURIOLV2_MIDHI)
          return false;
-      if (RawSignal.Pulses[x] > AURIOLV2_PULSEMAXMIN)
+      if (gapsSplit ? features.isLong(x) : frame.Pulses[x] > AURIOLV2_PULSEMAXMIN)
       {
-         if (RawSignal.Pulses[x] > AURIOLV2_PULSEMAX)
+         if (!gapsSplit && frame.Pulses[x] > AURIOLV2_PULSEMAX)
             return false;
          if (bitcounter < 24)
          {
@@ -105,9 +116,9 @@ boolean Plugin_046(byte function, const char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] > AURIOLV2_PULSEMINMAX)
+         if (!gapsSplit && frame.Pulses[x] > AURIOLV2_PULSEMINMAX)
             return false;
-         if (RawSignal.Pulses[x] < AURIOLV2_PULSEMIN)
+         if (!gapsSplit && frame.Pulses[x] < AURIOLV2_PULSEMIN)
             return false;
          if (bitcounter < 24)
          {
@@ -130,9 +141,7 @@ boolean Plugin_046(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 8) | (bitstream2 & 0xFF); // All but "1111" padded section
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (!DedupCache::isNewPayload(46, tmpval, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Now process the various sensor types
@@ -143,7 +152,7 @@ boolean Plugin_046(byte function, const char *string)
       type = 0; // Auriol has no humidity part
    else
       type = 1; // Xiron
-   // if (RawSignal.Pulses[0] != AURIOLV2_PLUGIN_ID)
+   // if (frame.Pulses[0] != AURIOLV2_PLUGIN_ID)
    //   return false; // only accept plugin_001 translated Xiron packets
    //==================================================================================
    if (type == 0)
@@ -199,8 +208,11 @@ boolean Plugin_046(byte function, const char *string)
    display_CHAN(channel);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
+
+boolean Plugin_046(byte function, const char *string)
+{
+   return Plugin_046(PulseSpan(RawSignal));
+}
 #endif // PLUGIN_046
@@ -34,6 +34,7 @@
  \*********************************************************************************************/
 #define AURIOLV4_PLUGIN_ID 047
 #define PLUGIN_DESC_047 "Auriol V4"
+#define PLUGIN_PULSES_047 {AURIOLV4_PULSECOUNT - 4, AURIOLV4_PULSECOUNT + 2}
 #define AURIOLV4_PULSECOUNT 88
 
 #define AURIOLV4_MIDLO_D 128
@@ -127,9 +128,7 @@ boolean Plugin_047(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(47, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
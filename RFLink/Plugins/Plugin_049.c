@@ -89,6 +89,7 @@
 
 #define LACROSSE49_PLUGIN_ID 049
 #define PLUGIN_DESC_049 "LaCrosse-TX141"
+#define PLUGIN_PULSES_049 {LACROSSE49_MINPULSECOUNT, PLUGIN_PULSES_MAX}
 
 #define LACROSSE49_MINPULSECOUNT 72 // signal  is repeated without a break so there is a high chance it will be seen a single very large message
 #define LACROSSE49_PREAMBLE_PULSE_LENGTH_MIN_D 690
@@ -120,11 +121,11 @@ uint16_t LACROSSE49_SHORT_PULSE_MAX;
 uint16_t LACROSSE49_LONG_PULSE_MIN;
 uint16_t LACROSSE49_LONG_PULSE_MAX;
 
-inline int findPreamble(const int startPosition, const int endPosition) {
+inline int findPreamble(const PulseSpan &frame, const int startPosition, const int endPosition) {
   for(int i=startPosition; i<endPosition; i+=2) {
     bool found = true;
     for(int j=i; j < i+8; j++) {
-      if(RawSignal.Pulses[j] < LACROSSE49_PREAMBLE_PULSE_LENGTH_MIN || RawSignal.Pulses[j] > LACROSSE49_PREAMBLE_PULSE_LENGTH_MAX) {
+      if(frame.Pulses[j] < LACROSSE49_PREAMBLE_PULSE_LENGTH_MIN || frame.Pulses[j] > LACROSSE49_PREAMBLE_PULSE_LENGTH_MAX) {
         found = false;
         break;
       }
@@ -136,18 +137,18 @@ inline int findPreamble(const int startPosition, const int endPosition) {
   return -1;
 }
 
-inline short int PLUGIN_049_decode_pulse(uint16_t position) {
-  if( RawSignal.Pulses[position] < LACROSSE49_SHORT_PULSE_MIN )
+inline short int PLUGIN_049_decode_pulse(const PulseSpan &frame, uint16_t position) {
+  if( frame.Pulses[position] < LACROSSE49_SHORT_PULSE_MIN )
     return -1;
-  if( RawSignal.Pulses[position] > LACROSSE49_LONG_PULSE_MAX )
+  if( frame.Pulses[position] > LACROSSE49_LONG_PULSE_MAX )
     return -1;
 
-  if( RawSignal.Pulses[position+1] < LACROSSE49_SHORT_PULSE_MIN )
+  if( frame.Pulses[position+1] < LACROSSE49_SHORT_PULSE_MIN )
     return -1;
-  if( RawSignal.Pulses[position+1] > LACROSSE49_LONG_PULSE_MAX )
+  if( frame.Pulses[position+1] > LACROSSE49_LONG_PULSE_MAX )
     return -1;
 
-  return RawSignal.Pulses[position] > RawSignal.Pulses[position+1];
+  return frame.Pulses[position] > frame.Pulses[position+1];
 
 }
 
@@ -157,7 +158,7 @@ inline short int PLUGIN_049_decode_pulse(uint16_t position) {
  * @param toPosition
  * @return -1 if failed
  */
-inline bool PLUGIN_049_decode(int fromPosition, int toPosition ) {
+inline bool PLUGIN_049_decode(const PulseSpan &frame, int fromPosition, int toPosition ) {
 
   int messageLength = toPosition - (fromPosition+8);
   int bitCount = messageLength/2;
@@ -201,7 +202,7 @@ inline bool PLUGIN_049_decode(int fromPosition, int toPosition ) {
   sendRawPrint(printBuf, true);
   #endif
 
-  if(!data.fillFromPwmPulses(deviceType, RawSignal.Pulses, RawSignal.Number, fromPosition + 8, LACROSSE49_SHORT_PULSE_MIN, LACROSSE49_SHORT_PULSE_MAX, LACROSSE49_LONG_PULSE_MIN, LACROSSE49_LONG_PULSE_MAX)){
+  if(!data.fillFromPwmPulses(deviceType, frame.Pulses, frame.Number, fromPosition + 8, LACROSSE49_SHORT_PULSE_MIN, LACROSSE49_SHORT_PULSE_MAX, LACROSSE49_LONG_PULSE_MIN, LACROSSE49_LONG_PULSE_MAX)){
     #ifdef PLUGIN_049_DEBUG
     sprintf(printBuf, PSTR("LaCrosseTX141 failed to decode PWM"));
     sendRawPrint(printBuf, true);
@@ -303,24 +304,24 @@ inline bool PLUGIN_049_decode(int fromPosition, int toPosition ) {
   return true;
 }
 
-boolean Plugin_049(byte function, const char *string) {
+boolean Plugin_049(const PulseSpan &frame) {
 
-  if (RawSignal.Number < LACROSSE49_MINPULSECOUNT) {
+  if (frame.Number < LACROSSE49_MINPULSECOUNT) {
     return false;
   }
 
-  LACROSSE49_PREAMBLE_PULSE_LENGTH_MIN = LACROSSE49_PREAMBLE_PULSE_LENGTH_MIN_D / RawSignal.Multiply;
-  LACROSSE49_PREAMBLE_PULSE_LENGTH_MAX = LACROSSE49_PREAMBLE_PULSE_LENGTH_MAX_D / RawSignal.Multiply;
-  LACROSSE49_SHORT_PULSE_MIN = LACROSSE49_SHORT_PULSE_MIN_D / RawSignal.Multiply;
-  LACROSSE49_SHORT_PULSE_MAX = LACROSSE49_SHORT_PULSE_MAX_D / RawSignal.Multiply;
-  LACROSSE49_LONG_PULSE_MIN = LACROSSE49_LONG_PULSE_MIN_D / RawSignal.Multiply;
-  LACROSSE49_LONG_PULSE_MAX = LACROSSE49_LONG_PULSE_MAX_D / RawSignal.Multiply;
+  LACROSSE49_PREAMBLE_PULSE_LENGTH_MIN = LACROSSE49_PREAMBLE_PULSE_LENGTH_MIN_D / frame.Multiply;
+  LACROSSE49_PREAMBLE_PULSE_LENGTH_MAX = LACROSSE49_PREAMBLE_PULSE_LENGTH_MAX_D / frame.Multiply;
+  LACROSSE49_SHORT_PULSE_MIN = LACROSSE49_SHORT_PULSE_MIN_D / frame.Multiply;
+  LACROSSE49_SHORT_PULSE_MAX = LACROSSE49_SHORT_PULSE_MAX_D / frame.Multiply;
+  LACROSSE49_LONG_PULSE_MIN = LACROSSE49_LONG_PULSE_MIN_D / frame.Multiply;
+  LACROSSE49_LONG_PULSE_MAX = LACROSSE49_LONG_PULSE_MAX_D / frame.Multiply;
 
   uint16_t startPosition = 1;
 
   while(true) {
 
-    int preamblePosition = findPreamble(startPosition, RawSignal.Number - LACROSSE_TX141_BITLEN_MIN * 2 -
+    int preamblePosition = findPreamble(frame, startPosition, frame.Number - LACROSSE_TX141_BITLEN_MIN * 2 -
                                            8); // 32 is the number of bits of the smallest message + 8 pulses for preamble
 
     if (preamblePosition < 0) {
@@ -338,11 +339,11 @@ boolean Plugin_049(byte function, const char *string) {
 
     int secondPreamblePosition = -1;
 
-    if (RawSignal.Number > (preamblePosition) + (LACROSSE_TX141_BITLEN_MIN * 2 + 8) * 2) {
+    if (frame.Number > (preamblePosition) + (LACROSSE_TX141_BITLEN_MIN * 2 + 8) * 2) {
       #ifdef PLUGIN_049_DEBUG
       sendRawPrint(F("LaCrosseTX141 enough Pulses to discover a new another Preamble"), true);
       #endif
-      secondPreamblePosition = findPreamble(preamblePosition + LACROSSE_TX141_BITLEN_MIN * 2, RawSignal.Number - 8);
+      secondPreamblePosition = findPreamble(frame, preamblePosition + LACROSSE_TX141_BITLEN_MIN * 2, frame.Number - 8);
     }
 
     if (secondPreamblePosition > 0) {
@@ -351,17 +352,17 @@ boolean Plugin_049(byte function, const char *string) {
       sendRawPrint(printBuf, true);
       #endif
     } else {
-      secondPreamblePosition = RawSignal.Number + 1;
+      secondPreamblePosition = frame.Number + 1;
     }
 
-    if(PLUGIN_049_decode(preamblePosition, secondPreamblePosition))
+    if(PLUGIN_049_decode(frame, preamblePosition, secondPreamblePosition))
       return true;
 
     pbuffer[0] = 0;
 
     startPosition = secondPreamblePosition;
 
-    if((int)RawSignal.Number - startPosition < 72) {
+    if((int)frame.Number - startPosition < 72) {
       break;
     }
 
@@ -376,4 +377,8 @@ boolean Plugin_049(byte function, const char *string) {
 
 }
 
+boolean Plugin_049(byte function, const char *string) {
+  return Plugin_049(PulseSpan(RawSignal));
+}
+
 #endif // PLUGIN_049
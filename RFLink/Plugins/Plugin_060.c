@@ -28,6 +28,7 @@
  \*********************************************************************************************/
 #define ALARMPIRV0_PLUGIN_ID 060
 #define PLUGIN_DESC_060 "X10"
+#define PLUGIN_PULSES_060 {ALARMPIRV0_PULSECOUNT, ALARMPIRV0_PULSECOUNT}
 
 #define ALARMPIRV0_PULSECOUNT 26
 
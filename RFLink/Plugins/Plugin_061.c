@@ -38,6 +38,7 @@
  \*********************************************************************************************/
 #define ALARMPIRV1_PLUGIN_ID 061
 #define PLUGIN_DESC_061 "EV1527"
+#define PLUGIN_PULSES_061 {ALARMPIRV1_PULSECOUNT, ALARMPIRV1_PULSECOUNT}
 
 #define ALARMPIRV1_PULSECOUNT 50
 
@@ -47,42 +48,29 @@
 
 #ifdef PLUGIN_061
 #include "../4_Display.h"
+#include "../20_OokDecoder.h"
 
-boolean Plugin_061(byte function, const char *string)
+// 24 bits in the gaps, each followed by a mark of the opposite length
+static constexpr OokDecoder::Protocol ALARMPIRV1_PROTOCOL PROGMEM =
+    OokDecoder::pulsePairs(ALARMPIRV1_PULSECOUNT, 2, 24, {ALARMPIRV1_PULSEMIN_D, ALARMPIRV1_PULSEMID_D}, {ALARMPIRV1_PULSEMID_D + 1, ALARMPIRV1_PULSEMAX_D},
+                           1, OokDecoder::PairCheck::Opposite, -1);
+static_assert(OokDecoder::isValid(ALARMPIRV1_PROTOCOL), "invalid EV1527 protocol");
+
+boolean Plugin_061(const PulseSpan &frame)
 {
-   if (RawSignal.Number != ALARMPIRV1_PULSECOUNT)
+   if (frame.Number != ALARMPIRV1_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[0] == 63)
+   if (frame.Pulses[0] == 63)
       return false; // No need to test, packet for plugin 63
 
-   const long ALARMPIRV1_PULSEMID = ALARMPIRV1_PULSEMID_D / RawSignal.Multiply;
-   const long ALARMPIRV1_PULSEMAX = ALARMPIRV1_PULSEMAX_D / RawSignal.Multiply;
-   const long ALARMPIRV1_PULSEMIN = ALARMPIRV1_PULSEMIN_D / RawSignal.Multiply;
-
-   unsigned long bitstream = 0L;
-   unsigned long bitstream2 = 0L;
    //==================================================================================
    // Get all 24 bits
    //==================================================================================
-   for (byte x = 2; x <= 48; x += 2)
-   {
-      if (RawSignal.Pulses[x] > ALARMPIRV1_PULSEMID)
-      {
-         if (RawSignal.Pulses[x] > ALARMPIRV1_PULSEMAX)
-            return false; // pulse too long
-         if (RawSignal.Pulses[x - 1] > ALARMPIRV1_PULSEMID)
-            return false; // invalid pulse sequence 10/01
-         bitstream = bitstream << 1;
-      }
-      else
-      {
-         if (RawSignal.Pulses[x] < ALARMPIRV1_PULSEMIN)
-            return false; // pulse too short
-         if (RawSignal.Pulses[x - 1] < ALARMPIRV1_PULSEMID)
-            return false; // invalid pulse sequence 10/01
-         bitstream = (bitstream << 1) | 0x1;
-      }
-   }
+   uint64_t bits;
+   if (!OokDecoder::decode(frame, ALARMPIRV1_PROTOCOL, bits))
+      return false;
+   unsigned long bitstream = bits;
+   unsigned long bitstream2 = 0L;
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
@@ -117,8 +105,11 @@ boolean Plugin_061(byte function, const char *string)
    display_CMD(CMD_Single, CMD_On); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
+
+boolean Plugin_061(byte function, const char *string)
+{
+   return Plugin_061(PulseSpan(RawSignal));
+}
 #endif // Plugin_061
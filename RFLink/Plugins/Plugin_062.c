@@ -25,6 +25,7 @@
  \*********************************************************************************************/
 #define ALARMPIRV2_PLUGIN_ID 062
 #define PLUGIN_DESC_062 "Chuango"
+#define PLUGIN_PULSES_062 {ALARMPIRV2_PULSECOUNT, ALARMPIRV2_PULSECOUNT}
 
 #define ALARMPIRV2_PULSECOUNT 50
 
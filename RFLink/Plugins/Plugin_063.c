@@ -21,6 +21,7 @@
  \*********************************************************************************************/
 #define OREGON_PLA_PLUGIN_ID 063
 #define PLUGIN_DESC_063 "X10"
+#define PLUGIN_PULSES_063 {OREGON_PLA_PULSECOUNT - 2, OREGON_PLA_PULSECOUNT}
 
 #define OREGON_PLA_PULSECOUNT 52
 
@@ -22,6 +22,7 @@
 
 #define ATLANTIC_PLUGIN_ID 064
 #define PLUGIN_DESC_064 "Atlantic"
+#define PLUGIN_PULSES_064 {ATLANTIC_PULSECOUNT, ATLANTIC_PULSECOUNT}, {ATLANTIC_PULSECOUNT_TOO_SHORT_BREAK, ATLANTIC_PULSECOUNT_TOO_SHORT_BREAK}
 #define ATLANTIC_PULSECOUNT 74
 #define ATLANTIC_PULSECOUNT_TOO_SHORT_BREAK 223
 
@@ -77,10 +78,8 @@ boolean Plugin_064(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer) + 700 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream;
-   else
-      return true; // packet already seen
+   if (!DedupCache::isNewPayload(64, bitstream, Signal::params::signal_repeat_time + 700))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Extract data
    //==================================================================================
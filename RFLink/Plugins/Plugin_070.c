@@ -44,6 +44,7 @@
  \*********************************************************************************************/
 #define SELECTPLUS_PLUGIN_ID 070
 #define PLUGIN_DESC_070 "SelectPlus"
+#define PLUGIN_PULSES_070 {SELECTPLUS_PULSECOUNT, SELECTPLUS_PULSECOUNT}
 #define SELECTPLUS_PULSECOUNT 36
 
 #define SELECTPLUS_PULSEMID_D 650
@@ -91,9 +92,7 @@ boolean Plugin_070(byte function, const char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (!DedupCache::isNewPayload(70, bitstream, Signal::params::signal_repeat_time + 1000))
         return true; // already seen the RF packet recently
     //==================================================================================
     // all bytes received, make sure checksum is okay
@@ -37,6 +37,7 @@
  \*********************************************************************************************/
 #define PLIEGER_PLUGIN_ID 071
 #define PLUGIN_DESC_071 "Plieger"
+#define PLUGIN_PULSES_071 {PLIEGER_PULSECOUNT, PLIEGER_PULSECOUNT}
 
 #define PLIEGER_PULSECOUNT 66
 
@@ -88,9 +89,7 @@ boolean Plugin_071(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(71, bitstream, Signal::params::signal_repeat_time + 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    id = ((bitstream >> 16) & 0xFFFF); // get 16 bits unique address
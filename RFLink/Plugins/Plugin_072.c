@@ -31,6 +31,7 @@
  \*********************************************************************************************/
 #define BYRON_PLUGIN_ID 072
 #define PLUGIN_DESC_072 "Byron SX"
+#define PLUGIN_PULSES_072 {BYRON_PULSECOUNT, BYRON_PULSECOUNT}
 
 #define BYRON_PULSECOUNT 26
 
@@ -85,9 +86,7 @@ boolean Plugin_072(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(72, bitstream, Signal::params::signal_repeat_time + 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -33,6 +33,7 @@
  \*********************************************************************************************/
 #define DELTRONIC_PLUGIN_ID 073
 #define PLUGIN_DESC_073 "Deltronic"
+#define PLUGIN_PULSES_073 {DELTRONIC_PULSECOUNT, DELTRONIC_PULSECOUNT}
 
 #define DELTRONIC_PULSECOUNT 26
 
@@ -87,9 +88,7 @@ boolean Plugin_073(byte function, const char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (!DedupCache::isNewPayload(73, bitstream, Signal::params::signal_repeat_time + 1000))
         return true; // already seen the RF packet recently
     //==================================================================================
     // Output
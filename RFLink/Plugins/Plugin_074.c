@@ -35,6 +35,7 @@
  \*********************************************************************************************/
 #define RL02_PLUGIN_ID 074
 #define PLUGIN_DESC_074 "Byron MP"
+#define PLUGIN_PULSES_074 {RL02_CodeLength * 4 + 2, RL02_CodeLength * 4 + 2}
 
 #define RL02_CodeLength 12
 
@@ -43,9 +44,9 @@
 #ifdef PLUGIN_074
 #include "../4_Display.h"
 
-boolean Plugin_074(byte function, const char *string)
+boolean Plugin_074(const PulseSpan &frame)
 {
-    if (RawSignal.Number != (RL02_CodeLength * 4) + 2)
+    if (frame.Number != (RL02_CodeLength * 4) + 2)
         return false;
 
     unsigned long bitstream = 0L;
@@ -53,20 +54,20 @@ boolean Plugin_074(byte function, const char *string)
     //==================================================================================
     // Get all 12 bits
     //==================================================================================
-    byte j = (RL02_T * 2) / RawSignal.Multiply;
+    byte j = (RL02_T * 2) / frame.Multiply;
     for (byte i = 0; i < RL02_CodeLength; i++)
     {
 
-        if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
+        if (frame.Pulses[4 * i + 1] < j && frame.Pulses[4 * i + 2] > j && frame.Pulses[4 * i + 3] < j && frame.Pulses[4 * i + 4] > j)
         {                    // 0101
             bitstream >>= 1; // 0
         }
-        else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
+        else if (frame.Pulses[4 * i + 1] < j && frame.Pulses[4 * i + 2] > j && frame.Pulses[4 * i + 3] > j && frame.Pulses[4 * i + 4] < j)
         {
             bitstream >>= 1;                           // 0110
             bitstream |= (1 << (RL02_CodeLength - 1)); // 1
         }
-        else if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] < j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
+        else if (frame.Pulses[4 * i + 1] > j && frame.Pulses[4 * i + 2] < j && frame.Pulses[4 * i + 3] > j && frame.Pulses[4 * i + 4] < j)
         {                    // 1010
             bitstream >>= 1; // 0
         }
@@ -74,7 +75,7 @@ boolean Plugin_074(byte function, const char *string)
         {
             if (i == 0)
             {
-                if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
+                if (frame.Pulses[4 * i + 1] > j && frame.Pulses[4 * i + 2] > j && frame.Pulses[4 * i + 3] < j && frame.Pulses[4 * i + 4] > j)
                 {
                     bitstream >>= 1;                           // 1101
                     bitstream |= (1 << (RL02_CodeLength - 1)); // 1
@@ -97,9 +98,7 @@ boolean Plugin_074(byte function, const char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (!DedupCache::isNewPayload(74, bitstream, Signal::params::signal_repeat_time + 1000))
         return true; // already seen the RF packet recently
     //==================================================================================
     // Output
@@ -112,10 +111,13 @@ boolean Plugin_074(byte function, const char *string)
     display_CHIME(1);
     display_Footer();
     // ----------------------------------
-    RawSignal.Repeats = true;
-    RawSignal.Number = 0;
     return true;
 }
+
+boolean Plugin_074(byte function, const char *string)
+{
+    return Plugin_074(PulseSpan(RawSignal));
+}
 #endif //PLUGIN_074
 
 #ifdef PLUGIN_TX_074
@@ -38,6 +38,7 @@
 // ==================================================================================
 #define LIDL_PLUGIN_ID 075
 #define PLUGIN_DESC_075 "SilverCrest"
+#define PLUGIN_PULSES_075 {LIDL_PULSECOUNT, LIDL_PULSECOUNT}, {LIDL_PULSECOUNT2, LIDL_PULSECOUNT2}
 
 #define LIDL_PULSECOUNT 90   // type 0
 #define LIDL_PULSECOUNT2 114 // type 1
@@ -154,9 +155,7 @@ boolean Plugin_075(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(75, bitstream, Signal::params::signal_repeat_time + 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
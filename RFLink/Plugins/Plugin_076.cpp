@@ -39,6 +39,7 @@ using namespace RFLink::Radio;
 #endif
 
 #define PLUGIN_DESC_076 "CAME-TOP432"
+#define PLUGIN_PULSES_076 {PLUGIN_076_PULSE_COUNT, PLUGIN_076_PULSE_COUNT}
 
 #define PLUGIN_076_PULSE_COUNT 26
 
@@ -61,94 +62,24 @@ using namespace RFLink::Radio;
 #include "1_Radio.h"
 #include "2_Signal.h"
 #include "4_Display.h"
+#include "20_OokDecoder.h"
 
-#if defined(DEBUG) || defined(RFLINK_DEBUG)
-#define PLUGIN_076_DEBUG
-#endif
-
-inline short pulse_type_76(uint16_t pulse) {
-    
-    uint32_t pulse_len = pulse*RawSignal.Multiply;
-
-    if(pulse_len < PLUGIN_076_SHORT_PULSE_MIN)
-        return -1;
-    if(pulse_len <= PLUGIN_076_SHORT_PULSE_MAX)
-        return 0;
-    if(pulse_len < PLUGIN_076_LONG_PULSE_MIN)
-        return -1;
-    if(pulse_len > PLUGIN_076_LONG_PULSE_MAX)
-        return -1;
-    return 1;
-}
+// 12 pairs after the preamble, short then long is a 1, long then short a 0
+static constexpr OokDecoder::Protocol PLUGIN_076_PROTOCOL PROGMEM =
+    OokDecoder::pulsePairs(PLUGIN_076_PULSE_COUNT, 2, 12, {PLUGIN_076_SHORT_PULSE_MIN, PLUGIN_076_SHORT_PULSE_MAX}, {PLUGIN_076_LONG_PULSE_MIN, PLUGIN_076_LONG_PULSE_MAX},
+                           1, OokDecoder::PairCheck::OppositeInWindows)
+        .withPreamble({PLUGIN_076_PREAMBLE_MIN + 1, PLUGIN_076_PREAMBLE_MAX - 1});
+static_assert(OokDecoder::isValid(PLUGIN_076_PROTOCOL), "invalid CAME-TOP432 protocol");
 
-
-boolean Plugin_076(byte function, const char *string)
+boolean Plugin_076(const PulseSpan &frame)
 {
     static uint16_t lastSeenID = 0;
     static unsigned long lastSeenTime = 0;
-    
-    uint16_t code = 0;
-
-    if (RawSignal.Number != PLUGIN_076_PULSE_COUNT)
-        return false;
 
-    unsigned long duration = ((unsigned long)RawSignal.Pulses[1])*RawSignal.Multiply;
-    if(duration <= PLUGIN_076_PREAMBLE_MIN || duration >= PLUGIN_076_PREAMBLE_MAX) {
-        #ifdef PLUGIN_076_DEBUG
-        Serial.print("failed on check2 duration=");Serial.print(RawSignal.Pulses[1]);Serial.print("  multiply=");Serial.println(duration);
-        #endif
+    uint64_t bits;
+    if (!OokDecoder::decode(frame, PLUGIN_076_PROTOCOL, bits))
         return false;
-    }
-
-    for(int i=0; i < 12*2; i+=2) { // 12bits,
-        code = code << 1;
-
-        #ifdef PLUGIN_076_DEBUG
-        sprintf(tmpbuf, "Pulse pair: %u / %u", RawSignal.Pulses[2+i], RawSignal.Pulses[2+i+1]);
-        Serial.println(tmpbuf);
-        #endif
-        
-        short firstPulseType = pulse_type_76(RawSignal.Pulses[2+i]);
-        if(firstPulseType < 0){
-            #ifdef PLUGIN_076_DEBUG
-            Serial.print("failed on check3 duration=");Serial.print(RawSignal.Pulses[2+i]);Serial.print("  multiply=");Serial.println(RawSignal.Multiply);
-            #endif
-            return false;
-        }
-        short secondPulseType = pulse_type_76(RawSignal.Pulses[2+i+1]);
-        if(secondPulseType < 0){
-            #ifdef PLUGIN_076_DEBUG
-            Serial.print("failed on check4 duration=");Serial.print(RawSignal.Pulses[2+i+1]);Serial.print("  multiply=");Serial.println(RawSignal.Multiply);
-            #endif
-            return false;
-        }
-
-        if( firstPulseType == secondPulseType){
-            #ifdef PLUGIN_076_DEBUG
-            Serial.print("failed on check5 durations are equal:");Serial.print(RawSignal.Pulses[2+i]);Serial.print(" / "); Serial.println(RawSignal.Pulses[2+i+1]);
-            Serial.print("failed on check5 durations types:");Serial.print(firstPulseType);Serial.print(" / "); Serial.println(secondPulseType);
-            Serial.print("failed on check5 durations multiply:");Serial.print(RawSignal.Multiply);Serial.print(" at loop #");Serial.println(i);
-            #endif
-            return false;
-        }
-
-        if(firstPulseType == 0) {
-            code += 1;
-             #ifdef PLUGIN_076_DEBUG
-             Serial.println("Pair is a 1");
-             #endif
-        }
-        else {
-            #ifdef PLUGIN_076_DEBUG
-            Serial.println("Pair is a 0");
-            #endif
-        }
-    }
-
-    #ifdef PLUGIN_076_DEBUG
-    sprintf(tmpbuf, "***** CAME-TOP432 code= 0x%02x ********", code );
-    Serial.println(tmpbuf);
-    #endif
+    const uint16_t code = bits;
 
     auto now = millis();
 
@@ -167,12 +98,13 @@ boolean Plugin_076(byte function, const char *string)
     display_CMD(CMD_Single, CMD_On); // #ALL #ON
     display_Footer();
 
-    RawSignal.Repeats = 4;
-    RawSignal.Delay = 20;
-
-
     return true;
 }
+
+boolean Plugin_076(byte function, const char *string)
+{
+    return Plugin_076(PulseSpan(RawSignal));
+}
  #endif // PLUGIN_076
 
 #ifdef PLUGIN_TX_076
@@ -36,6 +36,7 @@
  \*********************************************************************************************/
 #define FA20_PLUGIN_ID 080
 #define PLUGIN_DESC_080 "FA20RF"
+#define PLUGIN_PULSES_080 {FA20_PULSECOUNT, FA20_PULSECOUNT}
 
 #define FA20_PULSECOUNT 50
 
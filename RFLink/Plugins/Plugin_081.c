@@ -42,6 +42,7 @@
  \*********************************************************************************************/
 #define MAXITROL1_PLUGIN_ID 081
 #define PLUGIN_DESC_081 "Mertik"
+#define PLUGIN_PULSES_081 {MAXITROL1_PULSECOUNT, MAXITROL1_PULSECOUNT}
 
 #define MAXITROL1_PULSECOUNT 46
 
@@ -101,9 +102,7 @@ boolean Plugin_081(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(81, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    command = (bitstream & 0x0F); // get address from pulses
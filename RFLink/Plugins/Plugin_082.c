@@ -42,6 +42,7 @@
  \*********************************************************************************************/
 #define MAXITROL2_PLUGIN_ID 082
 #define PLUGIN_DESC_082 "Mertik v2"
+#define PLUGIN_PULSES_082 {MAXITROL2_PULSECOUNT, MAXITROL2_PULSECOUNT}
 
 #define MAXITROL2_PULSECOUNT 26
 
@@ -102,9 +103,7 @@ boolean Plugin_082(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (!DedupCache::isNewPayload(82, bitstream, Signal::params::signal_repeat_time + 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    command = (bitstream & 0x0F); // get address from pulses
@@ -29,6 +29,7 @@
  \*********************************************************************************************/
 #define DOOYA_PLUGIN_ID 083
 #define PLUGIN_DESC_083 PSTR("BRELMOTOR")
+#define PLUGIN_PULSES_083 {DOOYA_PULSECOUNT_1, DOOYA_PULSECOUNT_1}
 #define DOOYA_PULSECOUNT_1 82
 
 #define DOOYA_MIDVALUE_D 384
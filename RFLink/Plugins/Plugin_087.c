@@ -15,6 +15,7 @@
 
 #define NOXALARMPLUGIN_ID 087
 #define PLUGIN_DESC_087 "NOXALARM"
+#define PLUGIN_PULSES_087 {NOX_CONTROL_PULSECOUNT, NOX_CONTROL_PULSECOUNT}
 
 
 #define NOX_SUPERPREAMBLE_PULSE_LEN 20000 
@@ -21,6 +21,7 @@
  \*********************************************************************************************/
 #define P254_PLUGIN_ID 254
 #define PLUGIN_DESC_254 "Unidentified Packet debugging"
+#define PLUGIN_PULSES_254 {24, PLUGIN_PULSES_MAX}
 
 #ifdef PLUGIN_254
 #include "../4_Display.h"
@@ -42,27 +43,23 @@ boolean Plugin_254(byte function, const char *string)
    //display_Name(PSTR("DEBUG"));
    //display_Footer();
    // ----------------------------------
-   RFLink::sendRawPrint(F("20;XX;DEBUG;Pulses=")); // debug data
-   RFLink::sendRawPrint(RawSignal.Number);         // print number of pulses
-   RFLink::sendRawPrint(F(";Pulses(uSec)="));      // print pulse durations
+   RFLink::LineWriter line;
+   line.print(F("20;XX;DEBUG;Pulses=")).print(RawSignal.Number); // debug data, number of pulses
+   line.print(F(";Pulses(uSec)="));                              // pulse durations
    // ----------------------------------
-   char dbuffer[5];
-
    for (i = 1; i < RawSignal.Number + 1; i++)
    {
       if (QRFUDebug == true)
-      {
-         sprintf(dbuffer, "%02x", RawSignal.Pulses[i]);
-         RFLink::sendRawPrint(dbuffer);
-      }
+         line.printHex((uint16_t)RawSignal.Pulses[i], 2, false);
       else
       {
-         RFLink::sendRawPrint(RawSignal.Pulses[i] * RawSignal.Multiply);
+         line.print(RawSignal.Pulses[i] * RawSignal.Multiply);
          if (i < RawSignal.Number)
-            RFLink::sendRawPrint(',');
+            line.print(',');
       }
    }
-   RFLink::sendRawPrint(F(";\r\n"));
+   line.print(';');
+   line.println();
    // ----------------------------------
    RawSignal.Number = 0; // Last plugin, kill packet
    return true;          // stop processing
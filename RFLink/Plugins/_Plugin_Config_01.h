@@ -98,6 +98,12 @@
 // Housekeeping
 // -------------------
 #define PLUGIN_254 // Debug to show unsupported packets
+// -------------------
+// Host-native build (env:native) compiles every available decoder
+// -------------------
+#ifdef RFLINK_NATIVE_BUILD
+#define PLUGIN_083 // Brel Motor / Dooya
+#endif
 // ****************************************************************************************************************************************
 // RFLink List of Plugins that have TRANSMIT functionality
 // ****************************************************************************************************************************************
@@ -31,6 +31,8 @@
 #include "11_Config.h"
 #include "12_Portal.h"
 #include "13_OTA.h"
+#include "17_NoiseFloor.h"
+#include "18_CaptureStream.h"
 
 #if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
 #include <avr/power.h>
@@ -105,6 +107,7 @@ namespace RFLink {
 #endif
       RFLink::Radio::setup();
       RFLink::Signal::setup();
+      RFLink::NoiseFloor::setup();
 
 #if defined(RFLINK_WIFI_ENABLED)
       RFLink::Wifi::setup();
@@ -120,6 +123,7 @@ namespace RFLink {
 
       PluginInit();
       PluginTXInit();
+      RFLink::Plugins::setup();
 
       Radio::set_Radio_mode(Radio::Radio_OFF);
 
@@ -147,6 +151,9 @@ namespace RFLink {
 #ifndef RFLINK_SERIAL2NET_DISABLED
       RFLink::Serial2Net::setup();
 #endif // !RFLINK_SERIAL2NET_DISABLED
+#ifndef RFLINK_CAPTURE_STREAM_DISABLED
+      RFLink::CaptureStream::setup();
+#endif // !RFLINK_CAPTURE_STREAM_DISABLED
 #endif
     }
 
@@ -163,6 +170,9 @@ namespace RFLink {
 #ifndef RFLINK_SERIAL2NET_DISABLED
       RFLink::Serial2Net::serverLoop();
 #endif // !RFLINK_SERIAL2NET_DISABLED
+#ifndef RFLINK_CAPTURE_STREAM_DISABLED
+      RFLink::CaptureStream::serverLoop();
+#endif // !RFLINK_CAPTURE_STREAM_DISABLED
 
 #if defined(SERIAL_ENABLED) && PIN_RF_TX_DATA_0 != NOT_A_PIN
       readSerialAndExecute();
@@ -180,10 +190,12 @@ namespace RFLink {
       }
 
       Radio::mainLoop();
+      NoiseFloor::loop();
       OTA::mainLoop();
     }
 
     void sendMsgFromBuffer() {
+      Signal::AsyncSignalScanner::lockDecoder();
       if (pbuffer[0] != 0) {
 
 #ifdef SERIAL_ENABLED
@@ -205,96 +217,63 @@ namespace RFLink {
 
         pbuffer[0] = 0;
       }
+      Signal::AsyncSignalScanner::unlockDecoder();
     }
 
     void sendRawPrint(const char *buf, bool end_of_line) {
       if (buf[0] != 0) {
+        // through the writer, after the text a writer still alive has buffered
+        LineWriter line;
+        line.print(buf);
+        if (end_of_line)
+          line.println();
+      }
+    }
 
+    void sendRawData(const char *buf, size_t length) {
 #ifdef SERIAL_ENABLED
-        Serial.print(buf);
-        if(end_of_line)
-          Serial.println();
+      Serial.write((const uint8_t *)buf, length);
 #endif
 #ifndef RFLINK_SERIAL2NET_DISABLED
-        RFLink::Serial2Net::broadcastMessage(buf);
-        if(end_of_line)
-          RFLink::Serial2Net::broadcastMessage(F("\r\n"));
+      RFLink::Serial2Net::broadcastMessage(buf, length);
 #endif // !RFLINK_SERIAL2NET_DISABLED
-
-      }
     }
 
     void sendRawPrint(long n)
     {
-#ifdef SERIAL_ENABLED
-      Serial.print(n);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(String(n).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      LineWriter().print(n);
     }
 
     void sendRawPrint(unsigned long n)
     {
-#ifdef SERIAL_ENABLED
-      Serial.print(n);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(String(n).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      LineWriter().print(n);
     }
 
     void sendRawPrint(int n)
     {
-#ifdef SERIAL_ENABLED
-      Serial.print(n);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(String(n).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      LineWriter().print(n);
     }
 
     void sendRawPrint(unsigned int n)
     {
-#ifdef SERIAL_ENABLED
-      Serial.print(n);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(String(n).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      LineWriter().print(n);
     }
 
   void sendRawPrint(float f)
   {
-#ifdef SERIAL_ENABLED
-    Serial.print(f);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-    RFLink::Serial2Net::broadcastMessage(String(f).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+    LineWriter().print(f);
   }
 
     void sendRawPrint(char c)
     {
-#ifdef SERIAL_ENABLED
-      Serial.write(c);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(c);
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      LineWriter().print(c);
     }
 
     void sendRawPrint(const __FlashStringHelper *buf, bool end_of_line){
-      #ifdef SERIAL_ENABLED
-      Serial.print(buf);
+      LineWriter line;
+      line.print(buf);
       if(end_of_line)
-        Serial.println();
-      #endif
-      #ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(buf);
-      if(end_of_line)
-        RFLink::Serial2Net::broadcastMessage(F("\r\n"));
-      #endif // !RFLINK_SERIAL2NET_DISABLED
+        line.println();
     };
 
     /**
@@ -302,6 +281,8 @@ namespace RFLink {
     bool executeCliCommand(char *cmd) {
       static byte ValidCommand = 0;
 
+      Signal::AsyncSignalScanner::lockDecoder(); // commands use pbuffer, RawSignal and the plugins
+
       // Copy input command to InputBuffer_Serial, because many plugins are based on it !
       if(cmd != InputBuffer_Serial) { // sometimes we already have the command in the right buffer
         memcpy(InputBuffer_Serial, cmd, INPUT_COMMAND_SIZE);;
@@ -390,6 +371,8 @@ namespace RFLink {
             Signal::executeCliCommand(cmd + 3 + 6 + 1);
           } else if (strncasecmp(cmd + 3, "config", 6) == 0) {
             Config::executeCliCommand(cmd + 3 + 6 + 1);
+          } else if (strncasecmp(cmd + 3, "plugins", 7) == 0) {
+            Plugins::executeCliCommand(cmd + 3 + 7 + 1);
           } else {
             // -------------------------------------------------------
             // Handle Generic Commands / Translate protocol data into Nodo text commands
@@ -422,6 +405,7 @@ namespace RFLink {
       ValidCommand = 0;
       sendMsgFromBuffer(); // in case there is a response waiting to be sent
       resetSerialBuffer();
+      Signal::AsyncSignalScanner::unlockDecoder();
       return true;
     }
 
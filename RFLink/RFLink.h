@@ -29,6 +29,10 @@
 
 //#define RFLINK_MQTT_DISABLED    // to disable MQTT entirely (not compiled at all)
 //#define RFLINK_PORTAL_DISABLED    // to disable Portal/Web UI
+//#define RFLINK_PLUGINS_STATS_DISABLED // to disable the per plugin calls/time counters (10;plugins;stats;)
+//#define RFLINK_SIGNAL_ISR_STATS_DISABLED // to disable the async receiver interrupt cycle counters (10;signal;isrStats;)
+//#define RFLINK_ASYNC_DECODE_TASK_DISABLED // ESP32: decode async frames from the main loop instead of a timer woken task
+//#define RFLINK_SIGNAL_COMPACT_PULSES // store received pulses on one byte each (log scale, within 2%) to halve the signal buffers RAM
 
 #if (defined(ESP32) || defined(ESP8266))
 // OLED display, 0.91" SSD1306 I2C
@@ -95,6 +99,8 @@ namespace RFLink {
     void sendRawPrint(unsigned int n);
     void sendRawPrint(float f);
     void sendRawPrint(char c);
+    /// Raw bytes to every output, in one write for each of them (see LineWriter)
+    void sendRawData(const char *buf, size_t length);
     inline void sendRawPrintln() {sendRawPrint(F("\r\n"));};
     //static void sendRawPrintf(const char *format, va_list args);
     //#define broadcastMessage_P(format, ...) sendRawPrintf(format, __VA_ARGS__)
@@ -0,0 +1,103 @@
+# Turns a binary capture stream (see RFLink/18_CaptureStream.h) back into the text lines the native replay CLI reads:
+#
+#   python tools/capture_decoder.py recording.bin > frames.txt           from a file, "-" for stdin
+#   python tools/capture_decoder.py --connect 192.168.1.10[:1901] > frames.txt   live, from the capture_port of a board
+#   .pio/build/native/program frames.txt
+#
+# Every frame gives "20;XX;DEBUG;Pulses=<n>;Pulses(uSec)=<pulses>;", with --verbose preceded by a comment line
+# holding its sequence number, time, RSSI and end reason. Gaps in the sequence numbers (frames the board had
+# to drop because the client was too slow) are reported on stderr.
+
+import socket
+import struct
+import sys
+
+MAGIC = b"RF"
+VERSION = 1
+HEADER = struct.Struct("<2sBHHIbBH")  # magic, version, payload length, sequence, time_ms, rssi, end reason, pulses
+DEFAULT_PORT = 1901
+END_REASONS = ["Unknown", "ReachedLongPulseTimeOut", "AttemptedNoiseFilter", "DynamicGapLengthReached", "SignalEndTimeout", "TooLong"]
+
+
+def read_varints(payload, count):
+    pulses = []
+    value = shift = 0
+    for byte in payload:
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            pulses.append(value)
+            value = shift = 0
+    if len(pulses) != count or shift != 0:
+        raise ValueError("payload holds %d pulses, header announced %d" % (len(pulses), count))
+    return pulses
+
+
+def frames(chunks):
+    """Yields (sequence, time_ms, rssi, end_reason, pulses) from an iterable of byte strings"""
+    buffer = b""
+    for chunk in chunks:
+        buffer += chunk
+        while len(buffer) >= HEADER.size:
+            if buffer[:2] != MAGIC or buffer[2] != VERSION:
+                # not at a frame start, resync on the next magic
+                next_magic = buffer.find(MAGIC, 1)
+                sys.stderr.write("skipped %d bytes of garbage\n" % (next_magic if next_magic > 0 else len(buffer)))
+                buffer = buffer[next_magic:] if next_magic > 0 else buffer[-1:]
+                continue
+            _, _, length, sequence, time_ms, rssi, end_reason, count = HEADER.unpack_from(buffer)
+            if len(buffer) < HEADER.size + length:
+                break
+            payload = buffer[HEADER.size:HEADER.size + length]
+            buffer = buffer[HEADER.size + length:]
+            yield sequence, time_ms, (None if rssi == -128 else rssi), end_reason, read_varints(payload, count)
+
+
+def read_file(stream, size=4096):
+    while True:
+        chunk = stream.read(size)
+        if not chunk:
+            return
+        yield chunk
+
+
+def read_socket(address):
+    host, _, port = address.partition(":")
+    with socket.create_connection((host, int(port) if port else DEFAULT_PORT)) as connection:
+        while True:
+            chunk = connection.recv(4096)
+            if not chunk:
+                return
+            yield chunk
+
+
+def main(argv):
+    verbose = "--verbose" in argv or "-v" in argv
+    argv = [arg for arg in argv if arg not in ("--verbose", "-v")]
+
+    if len(argv) == 2 and argv[0] == "--connect":
+        chunks = read_socket(argv[1])
+    elif len(argv) == 1:
+        chunks = read_file(sys.stdin.buffer) if argv[0] == "-" else read_file(open(argv[0], "rb"))
+    else:
+        sys.stderr.write("Usage: capture_decoder.py [--verbose] FILE|-|--connect HOST[:PORT]\n")
+        return 2
+
+    expected = None
+    try:
+        for sequence, time_ms, rssi, end_reason, pulses in frames(chunks):
+            if expected is not None and sequence != expected:
+                sys.stderr.write("%d frames dropped before frame %d\n" % ((sequence - expected) & 0xFFFF, sequence))
+            expected = (sequence + 1) & 0xFFFF
+            if verbose:
+                reason = END_REASONS[end_reason] if end_reason < len(END_REASONS) else str(end_reason)
+                print("# seq=%d time_ms=%d rssi=%s end=%s" % (sequence, time_ms, "?" if rssi is None else rssi, reason))
+            print("20;XX;DEBUG;Pulses=%d;Pulses(uSec)=%s;" % (len(pulses), ",".join(str(p) for p in pulses)))
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,87 @@
+# Extracts the sample captures found in the header comments of RFLink/Plugins/Plugin_*.c(pp)
+# into a pulse corpus usable by the native replay CLI (pio run -e native):
+#
+#   python tools/extract_plugin_corpus.py [output_file]
+#   .pio/build/native/program --bench tools/corpus/plugin_samples_v1.txt
+#
+# Every corpus line is "<source file>:<line> 20;XX;DEBUG;Pulses=<n>;Pulses(uSec)=<pulses>;"
+# Pulse lists wrapped over several comment lines are joined. Only complete samples are kept: the list must
+# hold as many values as announced by Pulses= (or one less, as older firmwares announced one extra pulse).
+# Frames which once broke the decoding are appended from REGRESSION_SAMPLES, as "regression:<name> 20;XX;DEBUG...".
+# Bump CORPUS_VERSION when the line format changes, samples are expected to only be added between versions.
+
+import argparse
+import os
+import re
+
+CORPUS_VERSION = 1
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+PLUGINS_DIR = os.path.join(ROOT, "RFLink", "Plugins")
+DEFAULT_OUTPUT = os.path.join(ROOT, "tools", "corpus", "plugin_samples_v%d.txt" % CORPUS_VERSION)
+
+# (name, pulses) of the frames kept to check that the decoding goes through them
+REGRESSION_SAMPLES = [
+    # every gap is 0: one cluster only, used to divide by the empty count of long pulses in the frame features
+    ("zero_gaps_74", ",".join(["500", "0"] * 37)),
+    ("zero_gaps_50", ",".join(["500", "0"] * 25)),
+]
+
+SAMPLE_RE = re.compile(r"Pulses=(\d+);\s*Pulses\(uSec\)=([0-9,]*)(;?)")
+CONTINUATION_RE = re.compile(r"^\s*(?:\*|//)?\s*([0-9][0-9,]*)(;?)")
+
+
+def extract(path):
+    samples = []
+    with open(path, encoding="utf-8", errors="replace") as source:
+        lines = source.read().splitlines()
+
+    for index, line in enumerate(lines):
+        for match in SAMPLE_RE.finditer(line):
+            announced = int(match.group(1))
+            pulses_text = match.group(2)
+            ended = match.group(3) == ";" or match.end() < len(line.rstrip())
+
+            next_index = index + 1
+            while not ended and pulses_text.endswith(",") and next_index < len(lines):
+                continuation = CONTINUATION_RE.match(lines[next_index])
+                if continuation is None:
+                    break
+                pulses_text += continuation.group(1)
+                ended = continuation.group(2) == ";"
+                next_index += 1
+
+            pulses = [p for p in pulses_text.split(",") if p]
+            if len(pulses) not in (announced, announced - 1):
+                continue
+            samples.append((index + 1, len(pulses), ",".join(pulses)))
+    return samples
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Extracts the plugin header samples into the native replay corpus")
+    parser.add_argument("output", nargs="?", default=DEFAULT_OUTPUT, help="corpus file to write (default: %(default)s)")
+    output = parser.parse_args().output
+    files = sorted(f for f in os.listdir(PLUGINS_DIR) if re.match(r"Plugin_\d+\.(c|cpp)$", f))
+
+    seen = set()
+    total = 0
+    with open(output, "w", newline="\n") as out:
+        out.write("# RFLink32 plugin sample corpus, version %d\n" % CORPUS_VERSION)
+        out.write("# generated by tools/extract_plugin_corpus.py from the plugin header comments, do not edit\n")
+        for name in files:
+            for line_number, count, pulses in extract(os.path.join(PLUGINS_DIR, name)):
+                if pulses in seen:  # same capture pasted in several plugins
+                    continue
+                seen.add(pulses)
+                out.write("%s:%d 20;XX;DEBUG;Pulses=%d;Pulses(uSec)=%s;\n" % (name, line_number, count, pulses))
+                total += 1
+        for name, pulses in REGRESSION_SAMPLES:
+            out.write("regression:%s 20;XX;DEBUG;Pulses=%d;Pulses(uSec)=%s;\n" % (name, len(pulses.split(",")), pulses))
+            total += 1
+
+    print("%d samples written to %s" % (total, output))
+
+
+if __name__ == "__main__":
+    main()